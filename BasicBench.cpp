@@ -0,0 +1,326 @@
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Interpreter.hpp"
+
+using namespace std;
+
+#ifndef BASIC_BENCH_DIR
+#define BASIC_BENCH_DIR "../bench"
+#endif
+
+// 统计全局 operator new 的调用次数与字节数
+static atomic<uint64_t> allocCount{0};
+static atomic<uint64_t> allocBytes{0};
+
+void* operator new(size_t size) {
+  allocCount.fetch_add(1, memory_order_relaxed);
+  allocBytes.fetch_add(size, memory_order_relaxed);
+  if (void* p = malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+struct Result {
+  string name;
+  string engine;
+  uint64_t statements = 0;
+  int iterations = 0;
+  double loadNs = 0;
+  double editNs = 0;
+  double bestNs = 0;
+  double medianNs = 0;
+  long peakRssKb = 0;
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  string error;
+};
+
+string benchDir = BASIC_BENCH_DIR;
+int iterations = 5;
+bool runTree = true, runVM = true, runJit = false, json = false, fusion = true;
+
+void usage(const char* progname) {
+  cout << progname << " [-h] [-n <iterations>] [-e tree|vm|jit|both|all] [-d <dir>] "
+          "[-j] [-F] [file.bas ...]"
+       << endl
+       << "    -h  Show this message and quit" << endl
+       << "    -n  Timed runs per workload, default value: " << iterations
+       << endl
+       << "    -e  Engine to measure (both = tree and vm, all adds jit), "
+          "default value: both"
+       << endl
+       << "    -d  Workload directory, default value: " << benchDir << endl
+       << "    -j  Emit machine-readable JSON instead of a table" << endl
+       << "    -F  Disable fused statements (same as --no-fuse)" << endl;
+}
+
+// 清零内核记录的 RSS 峰值，之后读到的 VmHWM 只反映本次运行
+void resetPeakRss() {
+  ofstream clearRefs("/proc/self/clear_refs");
+  clearRefs << "5";
+}
+
+long peakRssKb() {
+  ifstream status("/proc/self/status");
+  string line;
+  while (getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      return strtol(line.c_str() + 6, nullptr, 10);
+    }
+  }
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+vector<string> listWorkloads(const string& dir) {
+  vector<string> files;
+  if (DIR* d = opendir(dir.c_str())) {
+    while (dirent* entry = readdir(d)) {
+      string name = entry->d_name;
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".bas") == 0) {
+        files.push_back(dir + "/" + name);
+      }
+    }
+    closedir(d);
+  }
+  sort(files.begin(), files.end());
+  return files;
+}
+
+string baseName(const string& path) {
+  size_t slash = path.find_last_of('/');
+  string name = slash == string::npos ? path : path.substr(slash + 1);
+  return name.substr(0, name.rfind(".bas"));
+}
+
+double elapsedNs(chrono::steady_clock::time_point start) {
+  return chrono::duration<double, nano>(chrono::steady_clock::now() - start)
+      .count();
+}
+
+// 程序正中的一行，用于测量修改单行之后重新 RUN 的开销
+string middleLine(const string& path) {
+  ifstream in(path);
+  vector<string> lines;
+  string line;
+  while (getline(in, line)) {
+    if (!line.empty() && isdigit(static_cast<unsigned char>(line[0]))) {
+      lines.push_back(line);
+    }
+  }
+  return lines.empty() ? string() : lines[lines.size() / 2];
+}
+
+constexpr int kEditRuns = 101;
+
+// 重新输入一行并开始 RUN（不执行语句），取最快一次：
+// 衡量执行索引与字节码的更新代价
+double measureEdit(Interpreter& interpreter, const string& line,
+                   Engine engine) {
+  Program& program = interpreter.program();
+  double best = 0;
+  for (int i = 0; i < kEditRuns; ++i) {
+    auto start = chrono::steady_clock::now();
+    interpreter.processLine(line);
+    program.start(engine);
+    double ns = elapsedNs(start);
+    best = i == 0 ? ns : min(best, ns);
+  }
+  return best;
+}
+
+// 在进程内载入并反复运行一个程序，输出写入 /dev/null
+Result measure(const string& path, Engine engine, int sink) {
+  Result result;
+  result.name = baseName(path);
+  result.engine = engine == Engine::JIT  ? "jit"
+                  : engine == Engine::VM ? "vm"
+                                         : "tree";
+  result.iterations = iterations;
+
+  Interpreter interpreter(sink);
+  Program& program = interpreter.program();
+  interpreter.parser().setFusion(fusion);
+  program.setFusion(fusion);
+  try {
+    auto start = chrono::steady_clock::now();
+    interpreter.load(path);
+    result.loadNs = elapsedNs(start);
+
+    // 预热：逐行执行原程序得到语句条数（执行计划去掉了 REM 与中转的
+    // GOTO，条数会变少），各引擎顺带完成分析或编译
+    program.setAnalysis(false);
+    program.run(Engine::TREE);
+    result.statements = program.executedStatements();
+    program.setAnalysis(true);
+    program.run(engine);
+
+    vector<double> times;
+    times.reserve(iterations);  // 计时窗口内不能有扩容，否则混入分配计数
+    for (int i = 0; i < iterations; ++i) {
+      resetPeakRss();
+      uint64_t count = allocCount.load(memory_order_relaxed);
+      uint64_t bytes = allocBytes.load(memory_order_relaxed);
+      start = chrono::steady_clock::now();
+      program.run(engine);
+      times.push_back(elapsedNs(start));
+      result.allocations = allocCount.load(memory_order_relaxed) - count;
+      result.allocatedBytes = allocBytes.load(memory_order_relaxed) - bytes;
+      result.peakRssKb = max(result.peakRssKb, peakRssKb());
+    }
+    sort(times.begin(), times.end());
+    result.bestNs = times.front();
+    result.medianNs = times[times.size() / 2];
+
+    string line = middleLine(path);
+    if (!line.empty()) {
+      result.editNs = measureEdit(interpreter, line, engine);
+    }
+  } catch (const BasicError& e) {
+    result.error = e.message();
+  }
+  program.output().flush();
+  return result;
+}
+
+double perSecond(const Result& r) {
+  return r.bestNs > 0 ? r.statements * 1e9 / r.bestNs : 0;
+}
+
+double nsPerStatement(const Result& r) {
+  return r.statements > 0 ? r.bestNs / r.statements : 0;
+}
+
+void printTable(const vector<Result>& results) {
+  cout << left << setw(14) << "workload" << setw(6) << "engine" << right
+       << setw(12) << "stmts" << setw(10) << "best ms" << setw(10)
+       << "median ms" << setw(14) << "stmts/s" << setw(9) << "ns/stmt"
+       << setw(10) << "rss KiB" << setw(8) << "allocs" << setw(12) << "edit us"
+       << endl;
+  cout << fixed;
+  for (const Result& r : results) {
+    cout << left << setw(14) << r.name << setw(6) << r.engine << right;
+    if (!r.error.empty()) {
+      cout << "  " << r.error << endl;
+      continue;
+    }
+    cout << setw(12) << r.statements << setprecision(2) << setw(10)
+         << r.bestNs / 1e6 << setw(10) << r.medianNs / 1e6 << setprecision(0)
+         << setw(14) << perSecond(r) << setprecision(2) << setw(9)
+         << nsPerStatement(r) << setw(10) << r.peakRssKb << setw(8)
+         << r.allocations << setw(12) << r.editNs / 1e3 << endl;
+  }
+}
+
+void printJson(const vector<Result>& results) {
+  cout << "{\"iterations\": " << iterations << ", \"benchmarks\": [";
+  cout << fixed << setprecision(2);
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& r = results[i];
+    cout << (i == 0 ? "" : ",") << "\n  {\"name\": \"" << r.name
+         << "\", \"engine\": \"" << r.engine << "\"";
+    if (!r.error.empty()) {
+      cout << ", \"error\": \"" << r.error << "\"}";
+      continue;
+    }
+    cout << ", \"statements\": " << r.statements
+         << ", \"load_ns\": " << r.loadNs << ", \"edit_ns\": " << r.editNs
+         << ", \"best_ns\": " << r.bestNs
+         << ", \"median_ns\": " << r.medianNs
+         << ", \"statements_per_sec\": " << perSecond(r)
+         << ", \"ns_per_statement\": " << nsPerStatement(r)
+         << ", \"peak_rss_kb\": " << r.peakRssKb
+         << ", \"allocations\": " << r.allocations
+         << ", \"allocated_bytes\": " << r.allocatedBytes << "}";
+  }
+  cout << "\n]}" << endl;
+}
+
+int main(int argc, char* argv[]) {
+  int opt;
+  while ((opt = getopt(argc, argv, "hn:e:d:jF")) != -1) {
+    switch (opt) {
+      case 'h':
+        usage(argv[0]);
+        return 0;
+      case 'n':
+        iterations = max(1, atoi(optarg));
+        break;
+      case 'e': {
+        string engine = optarg;
+        runTree = engine == "tree" || engine == "both" || engine == "all";
+        runVM = engine == "vm" || engine == "both" || engine == "all";
+        runJit = engine == "jit" || engine == "all";
+        break;
+      }
+      case 'd':
+        benchDir = optarg;
+        break;
+      case 'j':
+        json = true;
+        break;
+      case 'F':
+        fusion = false;
+        break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+
+  vector<string> files(argv + optind, argv + argc);
+  if (files.empty()) {
+    files = listWorkloads(benchDir);
+  }
+  if (files.empty()) {
+    cerr << "no workloads found in " << benchDir << endl;
+    return 1;
+  }
+
+  int sink = open("/dev/null", O_WRONLY);
+  vector<Result> results;
+  bool failed = false;
+  for (const string& file : files) {
+    for (Engine engine : {Engine::TREE, Engine::VM, Engine::JIT}) {
+      if ((engine == Engine::TREE && !runTree) ||
+          (engine == Engine::VM && !runVM) ||
+          (engine == Engine::JIT && !runJit)) {
+        continue;
+      }
+      results.push_back(measure(file, engine, sink));
+      failed = failed || !results.back().error.empty();
+    }
+  }
+  close(sink);
+
+  if (json) {
+    printJson(results);
+  } else {
+    printTable(results);
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,212 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Arena.hpp"
+#include "Expression.hpp"
+#include "VarState.hpp"
+
+using namespace std;
+
+// 表达式求值微基准：同一棵树分别用 CompoundExpression、makeCompound 创建的
+// BinOp 构造，以及降为 RPN 后求值，比较每次求值的耗时
+
+// 创建一个运算节点
+using MakeCompound = Expression* (*)(Arena&, Expression*, char, Expression*);
+
+Expression* makePlain(Arena& arena, Expression* left, char op,
+                      Expression* right) {
+  return arena.make<CompoundExpression>(left, op, right);
+}
+
+// 变量 A、B、C 占用槽位 0、1、2
+constexpr int kVariables = 3;
+constexpr int kValues[kVariables] = {3, 5, 7};
+
+struct Shape {
+  string name;
+  string description;
+  Expression* (*build)(Arena&, MakeCompound);
+};
+
+Expression* var(Arena& arena, int slot) {
+  return arena.make<VariableExpression>(slot);
+}
+
+Expression* num(Arena& arena, int value) {
+  return arena.make<ConstExpression>(value);
+}
+
+// A + 1
+Expression* buildLeaf(Arena& arena, MakeCompound make) {
+  return make(arena, var(arena, 0), '+', num(arena, 1));
+}
+
+// A * B - C / 3
+Expression* buildSmall(Arena& arena, MakeCompound make) {
+  Expression* product = make(arena, var(arena, 0), '*', var(arena, 1));
+  Expression* quotient = make(arena, var(arena, 2), '/', num(arena, 3));
+  return make(arena, product, '-', quotient);
+}
+
+// 向左倾斜的 64 层链：((((A + B) * 3) / 2) - C) ...，数值保持在 int 范围内
+Expression* buildDeep(Arena& arena, MakeCompound make) {
+  Expression* expr = var(arena, 0);
+  for (int level = 0; level < 64; ++level) {
+    switch (level % 4) {
+      case 0:
+        expr = make(arena, expr, '+', var(arena, 1));
+        break;
+      case 1:
+        expr = make(arena, expr, '*', num(arena, 3));
+        break;
+      case 2:
+        expr = make(arena, expr, '/', num(arena, 2));
+        break;
+      default:
+        expr = make(arena, expr, '-', var(arena, 2));
+        break;
+    }
+  }
+  return expr;
+}
+
+// 10000 层的链，只能按 RPN 安全求值时的典型输入
+Expression* buildLong(Arena& arena, MakeCompound make) {
+  Expression* expr = var(arena, 0);
+  for (int level = 0; level < 10000; ++level) {
+    expr = make(arena, expr, level % 2 ? '-' : '+', var(arena, 1 + level % 2));
+  }
+  return expr;
+}
+
+// 平衡树：底层 512 个形如 A * 2、B - 1、C / 3、A + B 的叶子对，上层交替 + 与 -
+Expression* buildWideLevel(Arena& arena, MakeCompound make, int depth,
+                           int& leaf) {
+  if (depth == 0) {
+    switch (leaf++ % 4) {
+      case 0:
+        return make(arena, var(arena, 0), '*', num(arena, 2));
+      case 1:
+        return make(arena, var(arena, 1), '-', num(arena, 1));
+      case 2:
+        return make(arena, var(arena, 2), '/', num(arena, 3));
+      default:
+        return make(arena, var(arena, 0), '+', var(arena, 1));
+    }
+  }
+  Expression* left = buildWideLevel(arena, make, depth - 1, leaf);
+  Expression* right = buildWideLevel(arena, make, depth - 1, leaf);
+  return make(arena, left, depth % 2 ? '+' : '-', right);
+}
+
+Expression* buildWide(Arena& arena, MakeCompound make) {
+  int leaf = 0;
+  return buildWideLevel(arena, make, 9, leaf);
+}
+
+const vector<Shape> shapes = {
+    {"leaf", "A + 1", buildLeaf},
+    {"small", "A * B - C / 3", buildSmall},
+    {"deep", "64-level left chain", buildDeep},
+    {"long", "10000-level chain", buildLong},
+    {"wide", "balanced, 512 leaf pairs", buildWide},
+};
+
+int runs = 5;
+// 每次计时运行大约求值的运算节点数
+constexpr uint64_t kNodesPerRun = 4'000'000;
+
+// 返回最快一次运行中每次求值的纳秒数
+double measure(const Expression* expr, const VarState& state,
+               uint64_t iterations, int& result) {
+  double best = 0;
+  volatile int sink = 0;
+  Fault fault;
+  for (int run = 0; run < runs; ++run) {
+    auto start = chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; ++i) {
+      sink = expr->evaluate(state, fault);
+    }
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() -
+                                               start)
+                    .count();
+    best = run == 0 ? ns : min(best, ns);
+  }
+  result = sink;
+  return best / iterations;
+}
+
+void usage(const char* progname) {
+  cout << progname << " [-h] [-n <runs>]" << endl
+       << "    -h  Show this message and quit" << endl
+       << "    -n  Timed runs per shape (best is reported), default value: "
+       << runs << endl;
+}
+
+int main(int argc, char* argv[]) {
+  int opt;
+  while ((opt = getopt(argc, argv, "hn:")) != -1) {
+    switch (opt) {
+      case 'h':
+        usage(argv[0]);
+        return 0;
+      case 'n':
+        runs = max(1, atoi(optarg));
+        break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+
+  VarState state;
+  for (int slot = 0; slot < kVariables; ++slot) {
+    state.setValue(slot, kValues[slot]);
+  }
+
+  cout << left << setw(8) << "shape" << setw(26) << "expression" << right
+       << setw(7) << "nodes" << setw(12) << "plain ns" << setw(12)
+       << "binop ns" << setw(12) << "rpn ns" << setw(9) << "binop" << setw(9)
+       << "rpn" << endl;
+  cout << fixed;
+  bool mismatch = false;
+  for (const Shape& shape : shapes) {
+    Arena arena;
+    Expression* plain = shape.build(arena, makePlain);
+    Expression* specialised = shape.build(arena, makeCompound);
+    Expression* rpn = RpnExpression::lower(
+        static_cast<CompoundExpression*>(shape.build(arena, makeCompound)),
+        arena);
+    int nodes = static_cast<int>(static_cast<RpnExpression*>(rpn)->size() / 2);
+    uint64_t iterations = max<uint64_t>(1, kNodesPerRun / nodes);
+
+    int plainResult = 0;
+    int specialisedResult = 0;
+    int rpnResult = 0;
+    double plainNs = measure(plain, state, iterations, plainResult);
+    double specialisedNs =
+        measure(specialised, state, iterations, specialisedResult);
+    double rpnNs = measure(rpn, state, iterations, rpnResult);
+    mismatch = mismatch || plainResult != specialisedResult ||
+               plainResult != rpnResult;
+
+    cout << left << setw(8) << shape.name << setw(26) << shape.description
+         << right << setw(7) << nodes << setprecision(2) << setw(12)
+         << plainNs << setw(12) << specialisedNs << setw(12) << rpnNs
+         << setw(8) << plainNs / specialisedNs << 'x' << setw(8)
+         << plainNs / rpnNs << 'x' << endl;
+  }
+  if (mismatch) {
+    cerr << "results differ between plain, specialised and RPN trees" << endl;
+    return 1;
+  }
+  return 0;
+}
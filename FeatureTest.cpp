@@ -0,0 +1,35 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "TestRunner.hpp"
+
+using namespace std;
+using namespace test_runner;
+
+const string traceFolder = "../test/features/";
+
+const int traceCount = 8;
+const string traces[traceCount] = {
+    "image01.in",   "batch01.in",  "batch02.in", "loops01.in",
+    "analyze01.in", "parens01.in", "load01.in",  "profile01.in"};
+
+// 参考输出随溢出策略不同时取 <name>.<策略>.out
+#if defined(BASIC_OVERFLOW_TRAP)
+const string variant = "trap";
+#elif defined(BASIC_OVERFLOW_WIDEN)
+const string variant = "widen";
+#else
+const string variant = "wrap";
+#endif
+
+// 扩展功能测试程序的主函数
+int main(int argc, char** argv) {
+  cout << "=== 扩展功能 BASIC 解释器测试程序 ===" << endl;
+  cout << "本程序将测试标程不支持的扩展功能" << endl;
+  cout << "=====================================" << endl;
+
+  Suite suite{traceFolder, vector<string>(traces, traces + traceCount),
+              "-------------------------------------", variant};
+  return runSuite(suite, argc, argv);
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "TestRunner.hpp"
+
+using namespace std;
+using namespace test_runner;
+
+const string traceFolder = "../test/";
+
+// 附着式测试点与 Scope 测试点，参考输出与两者各自的测试程序相同
+vector<string> allTraces() {
+  vector<string> traces;
+  for (int i = 0; i < 100; ++i) {
+    traces.push_back("trace" + string(i < 10 ? "0" : "") + to_string(i) +
+                     ".txt");
+  }
+  for (int i = 1; i <= 16; ++i) {
+    traces.push_back("scoped/scoped" + string(i < 10 ? "0" : "") +
+                     to_string(i) + ".in");
+  }
+  return traces;
+}
+
+// 每组参数一个服务器：默认预算，以及每条（或每 7 条）语句就让出一次的
+// 三种引擎。含 INPUT 的测试点在会话中每次都停下等待下一行
+const vector<vector<string>> servers = {
+    {},
+    {"--budget", "1"},
+    {"--vm", "--budget", "1"},
+    {"--jit", "--budget", "1"},
+    {"--jit", "--budget", "7", "--workers", "1"},
+};
+
+// 场景测试所用的引擎
+const vector<vector<string>> engines = {{}, {"--vm"}, {"--jit"}};
+
+// 经一个会话运行 input，输出须为 expected
+bool expect(const string& socketPath, const string& input,
+            const string& expected, int timeoutMs) {
+  Execution session = exchange(socketPath, input, timeoutMs);
+  return session.ok && session.output == expected;
+}
+
+// 只有一个工作线程时，停在 INPUT 上的会话不占用它：其他会话照常完成，
+// 之后补上输入，程序从暂停处继续
+bool inputSuspends(ServerProcess& server, int timeoutMs) {
+  Client waiting(server.socketPath);
+  if (!waiting.connected() ||
+      !waiting.send("10 INPUT A\n20 PRINT A * 2\nRUN\n", timeoutMs) ||
+      !waiting.receive(" ? ", timeoutMs)) {
+    return false;
+  }
+  if (!expect(server.socketPath, "PRINT 6 * 7\n", "42\n", timeoutMs)) {
+    return false;
+  }
+  if (!waiting.send("21\n", timeoutMs)) return false;
+  waiting.finish();
+  return waiting.receive("", timeoutMs) && waiting.output() == " ? 42\n";
+}
+
+// 只有一个工作线程时，死循环的会话用完预算即让出，其他会话照常完成；
+// 客户端断开后服务器继续服务新的会话
+bool budgetYields(ServerProcess& server, int timeoutMs) {
+  {
+    Client looping(server.socketPath);
+    if (!looping.connected() ||
+        !looping.send("10 PRINT 1\n20 GOTO 20\nRUN\n", timeoutMs) ||
+        !looping.receive("1\n", timeoutMs)) {
+      return false;
+    }
+    if (!expect(server.socketPath, "PRINT 6 * 7\n", "42\n", timeoutMs)) {
+      return false;
+    }
+  }
+  return expect(server.socketPath, "PRINT 6 * 7\n", "42\n", timeoutMs);
+}
+
+// 在单独的服务器上运行一个场景并报告结果
+bool scenario(const Options& options, const string& name,
+              vector<string> args,
+              bool (*check)(ServerProcess&, int)) {
+  ServerProcess server{args,
+                       options.cacheDir + "/server." + to_string(getpid()) +
+                           ".scenario.sock",
+                       -1};
+  bool passed = startServer(options.studentBasic, server, options.timeoutMs) &&
+                check(server, options.timeoutMs);
+  stopServer(server);
+  if (!options.silent) {
+    cout << "Scenario \"" << name << "\" (" << server.describe() << ") ... "
+         << (passed ? "Pass" : "Fail") << endl;
+  }
+  return passed;
+}
+
+// 服务器测试程序的主函数
+int main(int argc, char** argv) {
+  cout << "=== 服务器模式 BASIC 解释器测试程序 ===" << endl;
+  cout << "本程序将经套接字重放测试点并检查会话调度" << endl;
+  cout << "=======================================" << endl;
+
+  Options options = parseArguments(argc, argv, Options());
+  Suite suite{traceFolder, allTraces(), "---------------------------------------",
+              "", {}, servers};
+  int status = runSuite(suite, options);
+
+  // 单个测试点时只重放该测试点
+  if (!options.traceFile.empty()) return status;
+  int passed = 0, total = 0;
+  for (const vector<string>& engine : engines) {
+    vector<string> args = engine;
+    args.insert(args.end(), {"--workers", "1"});
+    passed += scenario(options, "INPUT 暂停", args, inputSuspends);
+    args.insert(args.end(), {"--budget", "7"});
+    passed += scenario(options, "预算让出", args, budgetYields);
+    total += 2;
+  }
+  cout << passed << " / " << total << " scenario(s) passed." << endl;
+  return status != 0 || passed != total ? 1 : 0;
+}
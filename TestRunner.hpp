@@ -0,0 +1,793 @@
+// 附着式、Scope、扩展功能与服务器测试共用的并行回归测试引擎。
+// 每个测试点由线程池中的一个线程负责：用 posix_spawn 启动程序，标准输入
+// 直接打开测试点文件，标准输出经管道读入私有缓冲区，互不共享临时文件。
+// 标准程序的输出按测试点内容的哈希缓存，测试点不变时不再重新运行。
+// 服务器模式的测试点经 Unix 域套接字发送给 code --server 的会话。
+#pragma once
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern char** environ;
+
+namespace test_runner {
+
+// 一组测试点
+struct Suite {
+  std::string traceFolder;
+  std::vector<std::string> traces;
+  // 测试开始前输出的分隔线
+  std::string separator;
+  // 参考输出的变体：测试点旁有 <name>.<variant>.out 时优先于 <name>.out，
+  // 用于随构建选项（如溢出策略）不同的输出
+  std::string variant;
+  // 默认引擎通过后，依次加上这些参数重跑学生程序，输出须与参考输出完全
+  // 相同（如 --vm、--jit），任一不同即判为失败
+  std::vector<std::string> engines;
+  // 每组参数启动一个 code --server 进程（-d 不影响）。默认引擎与重跑都
+  // 通过后，测试点的内容再经各服务器的一个会话发送，输出须与参考输出
+  // 完全相同；带 .args 的测试点不经服务器重放
+  std::vector<std::vector<std::string>> servers;
+};
+
+enum Verdict {
+  PASS = 0,
+  DEMO_ERROR = 1,     // 标准程序运行出错
+  STUDENT_ERROR = 2,  // 学生程序运行出错或超时
+  MEMORY_LEAK = 3,    // valgrind 报告错误（仅 -l）
+  WRONG_ANSWER = 4,
+  SKIPPED = 5  // -f 模式下首个失败之后未运行的测试点
+};
+
+struct Options {
+  std::string studentBasic = "./code";
+  std::string standerBasic = "../Basic-Demo-64bit";
+  std::string traceFile;
+  std::string cacheDir = "trace_cache";
+  int jobs = 0;
+  int timeoutMs = 1000;
+  int leakTimeoutMs = 5000;
+  bool silent = false, firstFail = false, hideError = false;
+  bool leakCheck = false, refreshCache = false, useColor = true;
+  // 只运行默认引擎，跳过 Suite::engines 的重跑
+  bool defaultEngineOnly = false;
+};
+
+struct Outcome {
+  std::string trace;
+  // 测试点旁 <name>.args 中以空白分隔的命令行参数，附在学生程序之后
+  std::vector<std::string> args;
+  std::string input;
+  std::string expected;
+  std::string actual;
+  // 出错时所用的引擎参数，默认引擎为空
+  std::string engine;
+  Verdict verdict = PASS;
+};
+
+struct Execution {
+  bool ok = false;
+  bool timedOut = false;
+  std::string output;
+};
+
+inline bool readFile(const std::string& path, std::string& content) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  std::ostringstream buffer;
+  buffer << in.rdbuf();
+  content = buffer.str();
+  return true;
+}
+
+// 先写临时文件再改名，多个线程写同一缓存项时不会读到半个文件
+inline void writeFileAtomic(const std::string& path,
+                            const std::string& content) {
+  std::string temp = path + ".tmp." + std::to_string(getpid()) + "." +
+                     std::to_string(std::hash<std::thread::id>()(
+                         std::this_thread::get_id()));
+  {
+    std::ofstream out(temp, std::ios::binary);
+    if (!out) return;
+    out << content;
+  }
+  std::rename(temp.c_str(), path.c_str());
+}
+
+// FNV-1a 64 位哈希，作为标准输出缓存的键
+inline std::string hashContent(const std::string& content) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char ch : content) {
+    hash ^= ch;
+    hash *= 1099511628211ull;
+  }
+  char text[17];
+  std::snprintf(text, sizeof(text), "%016llx",
+                static_cast<unsigned long long>(hash));
+  return text;
+}
+
+// 以 inputPath 为标准输入运行程序，在 timeoutMs 内收集其标准输出。
+// 管道带 O_CLOEXEC，其他线程启动的子进程不会继承写端。
+inline Execution execute(const std::vector<std::string>& args,
+                         const std::string& inputPath, int timeoutMs) {
+  Execution result;
+  int fds[2];
+  if (pipe2(fds, O_CLOEXEC) != 0) return result;
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 0, inputPath.c_str(), O_RDONLY,
+                                   0);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], 1);
+  posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+
+  std::vector<char*> argv;
+  for (const std::string& arg : args) {
+    argv.push_back(const_cast<char*>(arg.c_str()));
+  }
+  argv.push_back(nullptr);
+
+  pid_t pid;
+  int spawned =
+      posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(fds[1]);
+  if (spawned != 0) {
+    close(fds[0]);
+    return result;
+  }
+
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  char buffer[4096];
+  while (true) {
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now())
+                    .count();
+    if (left <= 0) {
+      result.timedOut = true;
+      kill(pid, SIGKILL);
+      break;
+    }
+    pollfd pfd{fds[0], POLLIN, 0};
+    int ready = poll(&pfd, 1, static_cast<int>(left));
+    if (ready < 0 && errno == EINTR) continue;
+    if (ready <= 0) continue;
+    ssize_t n = read(fds[0], buffer, sizeof(buffer));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    result.output.append(buffer, n);
+  }
+  close(fds[0]);
+
+  int status = 0;
+  while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+  }
+  result.ok =
+      !result.timedOut && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  return result;
+}
+
+// 以 --server 运行的学生程序
+struct ServerProcess {
+  std::vector<std::string> args;
+  std::string socketPath;
+  pid_t pid = -1;
+
+  // 失败时报告的引擎
+  std::string describe() const {
+    std::string text = "--server";
+    for (const std::string& arg : args) text += " " + arg;
+    return text;
+  }
+};
+
+// 连接 Unix 域套接字，返回非阻塞的描述符，失败时返回 -1
+inline int connectSocket(const std::string& path) {
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) return -1;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) return -1;
+  if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+// 启动服务器并等到套接字可以连接，启动失败或 timeoutMs 内未就绪时返回
+// false（进程仍须由 stopServer 回收）
+inline bool startServer(const std::string& program, ServerProcess& server,
+                        int timeoutMs) {
+  unlink(server.socketPath.c_str());
+  std::vector<std::string> args = {program, "--server", server.socketPath};
+  args.insert(args.end(), server.args.begin(), server.args.end());
+  std::vector<char*> argv;
+  for (const std::string& arg : args) {
+    argv.push_back(const_cast<char*>(arg.c_str()));
+  }
+  argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 0, "/dev/null", O_RDONLY, 0);
+  posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+  posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+  int spawned = posix_spawnp(&server.pid, argv[0], &actions, nullptr,
+                             argv.data(), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  if (spawned != 0) {
+    server.pid = -1;
+    return false;
+  }
+
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  while (std::chrono::steady_clock::now() < deadline) {
+    int fd = connectSocket(server.socketPath);
+    if (fd >= 0) {
+      // 服务器把这次连接当作一个立即关闭的会话丢弃
+      close(fd);
+      return true;
+    }
+    if (waitpid(server.pid, nullptr, WNOHANG) == server.pid) {
+      server.pid = -1;
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+inline void stopServer(ServerProcess& server) {
+  if (server.pid > 0) {
+    kill(server.pid, SIGKILL);
+    while (waitpid(server.pid, nullptr, 0) < 0 && errno == EINTR) {
+    }
+    server.pid = -1;
+  }
+  unlink(server.socketPath.c_str());
+}
+
+// 服务器会话的客户端一端，收到的输出累积在 output() 中
+class Client {
+ public:
+  explicit Client(const std::string& socketPath)
+      : fd_(connectSocket(socketPath)) {}
+  ~Client() {
+    if (fd_ >= 0) close(fd_);
+  }
+  Client(const Client&) = delete;
+  Client& operator=(const Client&) = delete;
+
+  bool connected() const { return fd_ >= 0; }
+  const std::string& output() const { return output_; }
+
+  // 在 timeoutMs 内发送全部数据，其间照常接收输出，避免双方都阻塞在写上。
+  // 服务器已关闭连接（如 QUIT 之后）时剩余数据不再发送，与标准输入相同
+  bool send(const std::string& data, int timeoutMs) {
+    auto deadline = after(timeoutMs);
+    size_t sent = 0;
+    while (sent < data.size() && !closed_) {
+      int ready = pump(POLLOUT, deadline);
+      if (ready < 0) return false;
+      if (!(ready & POLLOUT) || closed_) continue;
+      ssize_t n = ::send(fd_, data.data() + sent, data.size() - sent,
+                         MSG_NOSIGNAL);
+      if (n > 0) {
+        sent += n;
+      } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+        closed_ = true;
+      }
+    }
+    return true;
+  }
+
+  // 关闭写端：服务器处理完剩余输入、发完输出后关闭连接
+  void finish() { shutdown(fd_, SHUT_WR); }
+
+  // 接收输出，直到其末尾为 suffix；suffix 为空时直到服务器关闭连接。
+  // timeoutMs 内未等到时返回 false
+  bool receive(const std::string& suffix, int timeoutMs) {
+    auto deadline = after(timeoutMs);
+    while (true) {
+      if (!suffix.empty() && output_.size() >= suffix.size() &&
+          output_.compare(output_.size() - suffix.size(), suffix.size(),
+                          suffix) == 0) {
+        return true;
+      }
+      if (closed_) return suffix.empty();
+      if (pump(0, deadline) < 0) return false;
+    }
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static Clock::time_point after(int timeoutMs) {
+    return Clock::now() + std::chrono::milliseconds(timeoutMs);
+  }
+
+  // 等待可读或 events，读出已到达的全部输出；返回 poll 的结果事件，
+  // 超时或出错时返回 -1
+  int pump(short events, Clock::time_point deadline) {
+    while (true) {
+      auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      deadline - Clock::now())
+                      .count();
+      if (left <= 0) return -1;
+      pollfd pfd{fd_, static_cast<short>((closed_ ? 0 : POLLIN) | events),
+                 0};
+      int ready = poll(&pfd, 1, static_cast<int>(left));
+      if (ready < 0 && errno != EINTR) return -1;
+      if (ready <= 0) continue;
+      char buffer[4096];
+      while (!closed_ && (pfd.revents & (POLLIN | POLLHUP | POLLERR))) {
+        ssize_t n = recv(fd_, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+          output_.append(buffer, n);
+        } else if (n < 0 && errno == EINTR) {
+          continue;
+        } else {
+          // 对端关闭，或带着未读完的输入关闭时的 ECONNRESET
+          if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            closed_ = true;
+          }
+          break;
+        }
+      }
+      return pfd.revents;
+    }
+  }
+
+  int fd_;
+  std::string output_;
+  bool closed_ = false;
+};
+
+// 经服务器的一个会话运行 input：发送全部内容后关闭写端，收集输出直到
+// 服务器关闭连接
+inline Execution exchange(const std::string& socketPath,
+                          const std::string& input, int timeoutMs) {
+  Execution result;
+  Client client(socketPath);
+  if (!client.connected()) return result;
+  bool sent = client.send(input, timeoutMs);
+  client.finish();
+  result.ok = sent && client.receive("", timeoutMs);
+  result.timedOut = !result.ok;
+  result.output = client.output();
+  return result;
+}
+
+class Runner {
+ public:
+  Runner(const Options& options, const Suite& suite)
+      : options_(options),
+        variant_(suite.variant),
+        engines_(options.defaultEngineOnly ? std::vector<std::string>()
+                                           : suite.engines) {
+    // 套接字放在缓存目录下，带进程号以免多个测试程序同时运行时冲突
+    for (size_t i = 0; i < suite.servers.size(); ++i) {
+      servers_.push_back({suite.servers[i],
+                          options.cacheDir + "/server." +
+                              std::to_string(getpid()) + "." +
+                              std::to_string(i) + ".sock",
+                          -1});
+    }
+  }
+
+  // 并行运行全部测试点，按原顺序输出结果，返回通过的个数
+  int run(const std::vector<std::string>& traces) {
+    outcomes_.assign(traces.size(), Outcome());
+    for (size_t i = 0; i < traces.size(); ++i) {
+      outcomes_[i].trace = traces[i];
+    }
+    mkdir(options_.cacheDir.c_str(), 0755);
+
+    // 第一阶段：比较输出。启动失败的服务器不单独报告，经它重放的测试点
+    // 连接失败，判为学生程序出错
+    for (ServerProcess& server : servers_) {
+      startServer(options_.studentBasic, server, options_.timeoutMs);
+    }
+    parallelFor(traces.size(), [this](size_t i) { check(outcomes_[i]); });
+    for (ServerProcess& server : servers_) {
+      stopServer(server);
+    }
+    // 第二阶段（可选）：仅对输出正确的测试点做内存检查
+    bool leakCheck = options_.leakCheck;
+    if (leakCheck &&
+        !execute({"valgrind", "--version"}, "/dev/null", options_.leakTimeoutMs)
+             .ok) {
+      std::cout << "valgrind 不可用，跳过内存检查" << std::endl;
+      leakCheck = false;
+    }
+    if (leakCheck) {
+      parallelFor(traces.size(),
+                  [this](size_t i) { checkLeak(outcomes_[i]); });
+    }
+
+    int passed = 0;
+    for (const Outcome& outcome : outcomes_) {
+      if (outcome.verdict == SKIPPED) break;
+      report(outcome);
+      if (outcome.verdict == PASS) {
+        ++passed;
+      } else if (options_.firstFail) {
+        break;
+      }
+    }
+    return passed;
+  }
+
+  // 实际参与评分的测试点个数（-f 中断时少于总数）
+  int reported() const {
+    int count = 0;
+    for (const Outcome& outcome : outcomes_) {
+      if (outcome.verdict == SKIPPED) break;
+      ++count;
+      if (outcome.verdict != PASS && options_.firstFail) break;
+    }
+    return count;
+  }
+
+ private:
+  template <typename Work>
+  void parallelFor(size_t count, Work work) {
+    unsigned workers = options_.jobs > 0
+                           ? options_.jobs
+                           : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min<unsigned>(workers, count);
+    std::atomic<size_t> next{0};
+    auto loop = [&]() {
+      for (size_t i = next++; i < count; i = next++) {
+        work(i);
+      }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < workers; ++i) {
+      threads.emplace_back(loop);
+    }
+    loop();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  // 参考输出：测试点旁有同名 .out 文件（及其变体）时直接使用，否则运行
+  // 标准程序并缓存
+  bool reference(Outcome& outcome) {
+    std::string base = outcome.trace.substr(0, outcome.trace.rfind('.'));
+    if (base != outcome.trace &&
+        ((!variant_.empty() &&
+          readFile(base + "." + variant_ + ".out", outcome.expected)) ||
+         readFile(base + ".out", outcome.expected))) {
+      return true;
+    }
+    std::string cached =
+        options_.cacheDir + "/" + hashContent(outcome.input) + ".out";
+    if (!options_.refreshCache && readFile(cached, outcome.expected)) {
+      return true;
+    }
+    Execution demo = execute({options_.standerBasic}, outcome.trace,
+                             options_.timeoutMs);
+    if (!demo.ok) return false;
+    outcome.expected = demo.output;
+    writeFileAtomic(cached, outcome.expected);
+    return true;
+  }
+
+  void check(Outcome& outcome) {
+    if (options_.firstFail && failed_.load()) {
+      outcome.verdict = SKIPPED;
+      return;
+    }
+    readFile(outcome.trace, outcome.input);
+    std::string args;
+    std::string base = outcome.trace.substr(0, outcome.trace.rfind('.'));
+    if (base != outcome.trace && readFile(base + ".args", args)) {
+      std::istringstream in(args);
+      for (std::string arg; in >> arg;) {
+        outcome.args.push_back(arg);
+      }
+    }
+    if (!reference(outcome)) {
+      outcome.verdict = DEMO_ERROR;
+    } else {
+      outcome.verdict = compare(command({options_.studentBasic}, outcome),
+                                outcome);
+      for (size_t i = 0; i < engines_.size() && outcome.verdict == PASS; ++i) {
+        outcome.engine = engines_[i];
+        outcome.verdict = compare(
+            command({options_.studentBasic, outcome.engine}, outcome),
+            outcome);
+      }
+      for (size_t i = 0; i < servers_.size() && outcome.args.empty() &&
+                         outcome.verdict == PASS;
+           ++i) {
+        outcome.engine = servers_[i].describe();
+        Execution session = exchange(servers_[i].socketPath, outcome.input,
+                                     options_.timeoutMs);
+        outcome.actual = session.output;
+        if (!session.ok) {
+          outcome.verdict = STUDENT_ERROR;
+        } else if (outcome.actual != outcome.expected) {
+          outcome.verdict = WRONG_ANSWER;
+        }
+      }
+      if (outcome.verdict == PASS) outcome.engine.clear();
+    }
+    if (outcome.verdict != PASS) failed_ = true;
+  }
+
+  // 运行一次学生程序并与参考输出比较
+  Verdict compare(const std::vector<std::string>& args, Outcome& outcome) {
+    Execution student = execute(args, outcome.trace, options_.timeoutMs);
+    outcome.actual = student.output;
+    if (!student.ok) return STUDENT_ERROR;
+    return outcome.actual == outcome.expected ? PASS : WRONG_ANSWER;
+  }
+
+  void checkLeak(Outcome& outcome) {
+    if (outcome.verdict != PASS) return;
+    Execution valgrind =
+        execute(command({"valgrind", "--error-exitcode=2", "--leak-check=full",
+                         options_.studentBasic},
+                        outcome),
+                outcome.trace, options_.leakTimeoutMs);
+    if (!valgrind.ok) outcome.verdict = MEMORY_LEAK;
+  }
+
+  // 学生程序的命令行：prefix 之后附上测试点的参数
+  static std::vector<std::string> command(std::vector<std::string> prefix,
+                                          const Outcome& outcome) {
+    prefix.insert(prefix.end(), outcome.args.begin(), outcome.args.end());
+    return prefix;
+  }
+
+  std::string color(const char* code) const {
+    return options_.useColor ? code : "";
+  }
+
+  void report(const Outcome& outcome) const {
+    if (options_.silent) return;
+    std::cout << "Trace \"" << outcome.trace << "\" ... ";
+    if (outcome.verdict == PASS) {
+      std::cout << color("\x1b[32;1m") << "Pass" << color("\x1b[0m")
+                << std::endl;
+      return;
+    }
+    std::cout << color("\x1b[31;1m") << "Fail" << color("\x1b[0m")
+              << std::endl;
+    if (options_.hideError) return;
+    if (!outcome.engine.empty())
+      std::cout << "Engine: " << outcome.engine << std::endl;
+    std::cout << "Trace file: " << std::endl
+              << color("\x1b[35m") << outcome.input << color("\x1b[0m")
+              << std::endl;
+    if (outcome.verdict == DEMO_ERROR)
+      std::cout << color("\x1b[31m")
+                << "Error occurred while running demo program"
+                << color("\x1b[0m") << std::endl;
+    if (outcome.verdict == STUDENT_ERROR)
+      std::cout << color("\x1b[31m")
+                << "Error occurred while running your program"
+                << color("\x1b[0m") << std::endl;
+    if (outcome.verdict == MEMORY_LEAK)
+      std::cout << color("\x1b[31m") << "Memory leak" << color("\x1b[0m")
+                << std::endl;
+    if (outcome.verdict == WRONG_ANSWER) {
+      std::cout << "Demo output: " << std::endl
+                << color("\x1b[36m") << outcome.expected << color("\x1b[0m")
+                << std::endl;
+      std::cout << "Your output: " << std::endl
+                << color("\x1b[33m") << outcome.actual << color("\x1b[0m")
+                << std::endl;
+    }
+  }
+
+  const Options& options_;
+  std::string variant_;
+  std::vector<std::string> engines_;
+  std::vector<ServerProcess> servers_;
+  std::vector<Outcome> outcomes_;
+  std::atomic<bool> failed_{false};
+};
+
+// 输出用法并退出：-h 时以 0 退出，参数错误时以 1 退出
+inline void usage(const char* progname, const Options& defaults,
+                  int status = 1) {
+  std::cout
+      << progname
+      << " [-h] [-e <your_exec>] [-s <stander_exec>] [-t <trace_file>] [-f] "
+         "[-m] [-q] [-j <jobs>] [-l] [-r] [-c <cache_dir>] [-d]"
+      << std::endl
+      << "    -h  Show this message and quit" << std::endl
+      << "    -e  Specify your executable file, default value: "
+      << defaults.studentBasic << std::endl
+      << "    -s  Specify demo executable file, default value: "
+      << defaults.standerBasic << std::endl
+      << "    -t  Run specified trace file" << std::endl
+      << "    -f  Stop at first failed test" << std::endl
+      << "    -m  Hide error message" << std::endl
+      << "    -q  Show final score only, cannot use with -t or -f, include -m"
+      << std::endl
+      << "    -j  Number of parallel jobs, default value: CPU count"
+      << std::endl
+      << "    -l  Also check memory with valgrind (separate, slower stage)"
+      << std::endl
+      << "    -r  Rerun the demo program instead of using cached output"
+      << std::endl
+      << "    -c  Demo output cache directory, default value: "
+      << defaults.cacheDir << std::endl
+      << "    -d  Run the default engine only, skip the --vm/--jit replays"
+      << std::endl;
+  exit(status);
+}
+
+inline Options parseArguments(int argc, char** argv, const Options& defaults) {
+  Options options = defaults;
+  bool student = false, stander = false;
+  int c;
+  opterr = 0;
+  while ((c = getopt(argc, argv, "e:s:t:fmqhj:lrc:d")) != -1) {
+    switch (c) {
+      case 'e':
+        if (student) usage(argv[0], defaults);
+        options.studentBasic = optarg;
+        student = true;
+        break;
+      case 's':
+        if (stander) usage(argv[0], defaults);
+        options.standerBasic = optarg;
+        stander = true;
+        break;
+      case 't':
+        if (options.traceFile.size()) usage(argv[0], defaults);
+        options.traceFile = optarg;
+        break;
+      case 'f':
+        if (options.firstFail) usage(argv[0], defaults);
+        options.firstFail = true;
+        break;
+      case 'm':
+        if (options.hideError) usage(argv[0], defaults);
+        options.hideError = true;
+        break;
+      case 'q':
+        if (options.silent) usage(argv[0], defaults);
+        options.silent = true;
+        break;
+      case 'j':
+        options.jobs = std::max(1, atoi(optarg));
+        break;
+      case 'l':
+        options.leakCheck = true;
+        break;
+      case 'r':
+        options.refreshCache = true;
+        break;
+      case 'c':
+        options.cacheDir = optarg;
+        break;
+      case 'd':
+        options.defaultEngineOnly = true;
+        break;
+      case 'h':
+        usage(argv[0], defaults, 0);
+        break;
+      default:
+        usage(argv[0], defaults);
+        break;
+    }
+  }
+  if (options.silent && (options.traceFile.size() || options.firstFail))
+    usage(argv[0], defaults);
+  if (options.silent) options.hideError = true;
+  return options;
+}
+
+// 按已解析的选项运行一组测试点，全部通过时返回 0
+inline int runSuite(const Suite& suite, const Options& options) {
+  auto color = [&](const char* code) {
+    return std::string(options.useColor ? code : "");
+  };
+
+  std::cout << "开始测试..." << std::endl;
+  std::cout << "学生程序: " << options.studentBasic << std::endl;
+  std::cout << "标准程序: " << options.standerBasic << std::endl;
+  if (!options.defaultEngineOnly && !suite.engines.empty()) {
+    std::cout << "重跑引擎:";
+    for (const std::string& engine : suite.engines) std::cout << ' ' << engine;
+    std::cout << std::endl;
+  }
+  for (const std::vector<std::string>& server : suite.servers) {
+    std::cout << "服务器参数:";
+    for (const std::string& arg : server) std::cout << ' ' << arg;
+    std::cout << std::endl;
+  }
+  std::cout << suite.separator << std::endl;
+
+  // 检查可执行文件是否存在
+  struct stat info;
+  if (stat(options.studentBasic.c_str(), &info) != 0) {
+    std::cout << color("\x1b[31m") << "错误: 学生程序 "
+              << options.studentBasic << " 不存在!" << color("\x1b[0m")
+              << std::endl;
+    return 1;
+  }
+  // 设置可执行权限
+  chmod(options.studentBasic.c_str(), info.st_mode | 0111);
+  if (stat(options.standerBasic.c_str(), &info) != 0) {
+    std::cout << color("\x1b[31m") << "错误: 标准程序 "
+              << options.standerBasic << " 不存在!" << color("\x1b[0m")
+              << std::endl;
+    return 1;
+  }
+  chmod(options.standerBasic.c_str(), info.st_mode | 0111);
+
+  std::vector<std::string> traces;
+  if (options.traceFile.size()) {
+    std::cout << "运行单个测试: " << options.traceFile << std::endl;
+    traces.push_back(options.traceFile);
+  } else {
+    std::cout << "运行所有测试用例..." << std::endl;
+    for (const std::string& trace : suite.traces) {
+      traces.push_back(suite.traceFolder + trace);
+    }
+  }
+
+  Runner runner(options, suite);
+  int correct = runner.run(traces);
+  int total = runner.reported();
+  if (total < static_cast<int>(traces.size())) {
+    std::cout << color("\x1b[31m") << "测试被中断" << color("\x1b[0m")
+              << std::endl;
+  }
+
+  int score = correct / 5 * 5;
+  if (!options.silent)
+    std::cout << correct << " / " << total << " trace(s) passed."
+              << std::endl;
+  if (total == static_cast<int>(suite.traces.size()) &&
+      options.traceFile.empty()) {
+    std::cout << "Final Score: " << (score / 10) << "." << (score % 10)
+              << std::endl;
+  }
+  std::cout << "测试完成" << std::endl;
+  return correct == static_cast<int>(traces.size()) ? 0 : 1;
+}
+
+// 测试程序的公共入口，全部通过时返回 0
+inline int runSuite(const Suite& suite, int argc, char** argv) {
+  return runSuite(suite, parseArguments(argc, argv, Options()));
+}
+
+}  // namespace test_runner
@@ -0,0 +1,10 @@
+1 REM Tight arithmetic loop: four statements per iteration
+10 LET I = 0
+20 LET S = 0
+30 LET S = S + I * 3 - I / 7
+40 LET T = (S - I) / 5 + I * I - (I + 1) * (I - 1)
+50 LET I = I + 1
+60 IF I < 500000 THEN 30
+70 PRINT S
+80 PRINT T
+90 END
@@ -0,0 +1,10 @@
+1 REM Arithmetic loop that stays within 32 bits, comparable under every overflow policy
+10 LET I = 0
+20 LET S = 0
+30 LET S = S / 2 + I * 3 - I / 7
+40 LET T = (S - I) / 5 + I * 7 - (I + 1) * 3
+50 LET I = I + 1
+60 IF I < 500000 THEN 30
+70 PRINT S
+80 PRINT T
+90 END
@@ -0,0 +1,408 @@
+1 REM Branching GOTO chain: every hop tests the changing pass counter, so it cannot be threaded away
+10 LET K = 0
+15 LET S = 0
+20 GOTO 4400
+90 LET K = K + 1
+95 IF K < 2000 THEN 20
+97 PRINT S
+99 END
+1000 IF K > 227 THEN 1020
+1010 GOTO 2160
+1020 LET S = S + 3
+1030 GOTO 2160
+1040 IF K > 58 THEN 1060
+1050 GOTO 4920
+1060 LET S = S + 7
+1070 GOTO 4920
+1080 IF K > 1225 THEN 1100
+1090 GOTO 2840
+1100 LET S = S + 7
+1110 GOTO 2840
+1120 IF K > 1063 THEN 1140
+1130 GOTO 3240
+1140 LET S = S + 4
+1150 GOTO 3240
+1160 IF K > 541 THEN 1180
+1170 GOTO 2280
+1180 LET S = S + 7
+1190 GOTO 2280
+1200 IF K > 1470 THEN 1220
+1210 GOTO 3400
+1220 LET S = S + 2
+1230 GOTO 3400
+1240 IF K > 726 THEN 1260
+1250 GOTO 2880
+1260 LET S = S + 6
+1270 GOTO 2880
+1280 IF K > 530 THEN 1300
+1290 GOTO 4360
+1300 LET S = S + 1
+1310 GOTO 4360
+1320 IF K > 1336 THEN 1340
+1330 GOTO 4200
+1340 LET S = S + 2
+1350 GOTO 4200
+1360 IF K > 191 THEN 1380
+1370 GOTO 3320
+1380 LET S = S + 2
+1390 GOTO 3320
+1400 IF K > 1612 THEN 1420
+1410 GOTO 1720
+1420 LET S = S + 1
+1430 GOTO 1720
+1440 IF K > 1374 THEN 1460
+1450 GOTO 2360
+1460 LET S = S + 5
+1470 GOTO 2360
+1480 IF K > 340 THEN 1500
+1490 GOTO 3160
+1500 LET S = S + 3
+1510 GOTO 3160
+1520 IF K > 1130 THEN 1540
+1530 GOTO 3680
+1540 LET S = S + 3
+1550 GOTO 3680
+1560 IF K > 160 THEN 1580
+1570 GOTO 2480
+1580 LET S = S + 2
+1590 GOTO 2480
+1600 IF K > 668 THEN 1620
+1610 GOTO 4000
+1620 LET S = S + 1
+1630 GOTO 4000
+1640 IF K > 1898 THEN 1660
+1650 GOTO 3280
+1660 LET S = S + 1
+1670 GOTO 3280
+1680 IF K > 57 THEN 1700
+1690 GOTO 2320
+1700 LET S = S + 2
+1710 GOTO 2320
+1720 IF K > 66 THEN 1740
+1730 GOTO 2760
+1740 LET S = S + 2
+1750 GOTO 2760
+1760 IF K > 1528 THEN 1780
+1770 GOTO 4520
+1780 LET S = S + 6
+1790 GOTO 4520
+1800 IF K > 1215 THEN 1820
+1810 GOTO 1960
+1820 LET S = S + 4
+1830 GOTO 1960
+1840 IF K > 539 THEN 1860
+1850 GOTO 3480
+1860 LET S = S + 5
+1870 GOTO 3480
+1880 IF K > 1987 THEN 1900
+1890 GOTO 4680
+1900 LET S = S + 4
+1910 GOTO 4680
+1920 IF K > 350 THEN 1940
+1930 GOTO 2600
+1940 LET S = S + 2
+1950 GOTO 2600
+1960 IF K > 190 THEN 1980
+1970 GOTO 4080
+1980 LET S = S + 5
+1990 GOTO 4080
+2000 IF K > 1868 THEN 2020
+2010 GOTO 3920
+2020 LET S = S + 6
+2030 GOTO 3920
+2040 IF K > 532 THEN 2060
+2050 GOTO 2520
+2060 LET S = S + 6
+2070 GOTO 2520
+2080 IF K > 599 THEN 2100
+2090 GOTO 1040
+2100 LET S = S + 6
+2110 GOTO 1040
+2120 IF K > 1924 THEN 2140
+2130 GOTO 2400
+2140 LET S = S + 5
+2150 GOTO 2400
+2160 IF K > 1518 THEN 2180
+2170 GOTO 4320
+2180 LET S = S + 4
+2190 GOTO 4320
+2200 IF K > 334 THEN 2220
+2210 GOTO 2640
+2220 LET S = S + 6
+2230 GOTO 2640
+2240 IF K > 554 THEN 2260
+2250 GOTO 4960
+2260 LET S = S + 3
+2270 GOTO 4960
+2280 IF K > 152 THEN 2300
+2290 GOTO 1200
+2300 LET S = S + 1
+2310 GOTO 1200
+2320 IF K > 1450 THEN 2340
+2330 GOTO 1880
+2340 LET S = S + 3
+2350 GOTO 1880
+2360 IF K > 1979 THEN 2380
+2370 GOTO 1080
+2380 LET S = S + 6
+2390 GOTO 1080
+2400 IF K > 356 THEN 2420
+2410 GOTO 4840
+2420 LET S = S + 6
+2430 GOTO 4840
+2440 IF K > 259 THEN 2460
+2450 GOTO 4280
+2460 LET S = S + 6
+2470 GOTO 4280
+2480 IF K > 207 THEN 2500
+2490 GOTO 3960
+2500 LET S = S + 3
+2510 GOTO 3960
+2520 IF K > 1210 THEN 2540
+2530 GOTO 1400
+2540 LET S = S + 7
+2550 GOTO 1400
+2560 IF K > 251 THEN 2580
+2570 GOTO 2080
+2580 LET S = S + 5
+2590 GOTO 2080
+2600 IF K > 149 THEN 2620
+2610 GOTO 4160
+2620 LET S = S + 3
+2630 GOTO 4160
+2640 IF K > 1460 THEN 2660
+2650 GOTO 3360
+2660 LET S = S + 7
+2670 GOTO 3360
+2680 IF K > 918 THEN 2700
+2690 GOTO 3720
+2700 LET S = S + 4
+2710 GOTO 3720
+2720 IF K > 1661 THEN 2740
+2730 GOTO 4120
+2740 LET S = S + 6
+2750 GOTO 4120
+2760 IF K > 127 THEN 2780
+2770 GOTO 1120
+2780 LET S = S + 3
+2790 GOTO 1120
+2800 IF K > 1827 THEN 2820
+2810 GOTO 3800
+2820 LET S = S + 7
+2830 GOTO 3800
+2840 IF K > 1435 THEN 2860
+2850 GOTO 1320
+2860 LET S = S + 1
+2870 GOTO 1320
+2880 IF K > 1028 THEN 2900
+2890 GOTO 1640
+2900 LET S = S + 7
+2910 GOTO 1640
+2920 IF K > 1226 THEN 2940
+2930 GOTO 90
+2940 LET S = S + 2
+2950 GOTO 90
+2960 IF K > 652 THEN 2980
+2970 GOTO 1560
+2980 LET S = S + 1
+2990 GOTO 1560
+3000 IF K > 1649 THEN 3020
+3010 GOTO 1680
+3020 LET S = S + 1
+3030 GOTO 1680
+3040 IF K > 1395 THEN 3060
+3050 GOTO 4880
+3060 LET S = S + 2
+3070 GOTO 4880
+3080 IF K > 470 THEN 3100
+3090 GOTO 3200
+3100 LET S = S + 2
+3110 GOTO 3200
+3120 IF K > 1154 THEN 3140
+3130 GOTO 4040
+3140 LET S = S + 7
+3150 GOTO 4040
+3160 IF K > 1031 THEN 3180
+3170 GOTO 3880
+3180 LET S = S + 4
+3190 GOTO 3880
+3200 IF K > 1171 THEN 3220
+3210 GOTO 3760
+3220 LET S = S + 3
+3230 GOTO 3760
+3240 IF K > 1662 THEN 3260
+3250 GOTO 2200
+3260 LET S = S + 5
+3270 GOTO 2200
+3280 IF K > 226 THEN 3300
+3290 GOTO 3520
+3300 LET S = S + 2
+3310 GOTO 3520
+3320 IF K > 1989 THEN 3340
+3330 GOTO 1800
+3340 LET S = S + 3
+3350 GOTO 1800
+3360 IF K > 1772 THEN 3380
+3370 GOTO 4560
+3380 LET S = S + 1
+3390 GOTO 4560
+3400 IF K > 191 THEN 3420
+3410 GOTO 4240
+3420 LET S = S + 3
+3430 GOTO 4240
+3440 IF K > 361 THEN 3460
+3450 GOTO 1760
+3460 LET S = S + 5
+3470 GOTO 1760
+3480 IF K > 854 THEN 3500
+3490 GOTO 3840
+3500 LET S = S + 6
+3510 GOTO 3840
+3520 IF K > 1777 THEN 3540
+3530 GOTO 3640
+3540 LET S = S + 3
+3550 GOTO 3640
+3560 IF K > 1971 THEN 3580
+3570 GOTO 1360
+3580 LET S = S + 1
+3590 GOTO 1360
+3600 IF K > 1260 THEN 3620
+3610 GOTO 2000
+3620 LET S = S + 5
+3630 GOTO 2000
+3640 IF K > 1547 THEN 3660
+3650 GOTO 1840
+3660 LET S = S + 4
+3670 GOTO 1840
+3680 IF K > 1445 THEN 3700
+3690 GOTO 4720
+3700 LET S = S + 4
+3710 GOTO 4720
+3720 IF K > 770 THEN 3740
+3730 GOTO 1240
+3740 LET S = S + 5
+3750 GOTO 1240
+3760 IF K > 32 THEN 3780
+3770 GOTO 3440
+3780 LET S = S + 4
+3790 GOTO 3440
+3800 IF K > 1705 THEN 3820
+3810 GOTO 1920
+3820 LET S = S + 1
+3830 GOTO 1920
+3840 IF K > 651 THEN 3860
+3850 GOTO 3000
+3860 LET S = S + 7
+3870 GOTO 3000
+3880 IF K > 1636 THEN 3900
+3890 GOTO 4800
+3900 LET S = S + 5
+3910 GOTO 4800
+3920 IF K > 32 THEN 3940
+3930 GOTO 1600
+3940 LET S = S + 7
+3950 GOTO 1600
+3960 IF K > 837 THEN 3980
+3970 GOTO 1440
+3980 LET S = S + 4
+3990 GOTO 1440
+4000 IF K > 1460 THEN 4020
+4010 GOTO 1480
+4020 LET S = S + 2
+4030 GOTO 1480
+4040 IF K > 444 THEN 4060
+4050 GOTO 4440
+4060 LET S = S + 1
+4070 GOTO 4440
+4080 IF K > 1423 THEN 4100
+4090 GOTO 3120
+4100 LET S = S + 6
+4110 GOTO 3120
+4120 IF K > 1249 THEN 4140
+4130 GOTO 4480
+4140 LET S = S + 7
+4150 GOTO 4480
+4160 IF K > 153 THEN 4180
+4170 GOTO 3600
+4180 LET S = S + 4
+4190 GOTO 3600
+4200 IF K > 317 THEN 4220
+4210 GOTO 4640
+4220 LET S = S + 3
+4230 GOTO 4640
+4240 IF K > 1414 THEN 4260
+4250 GOTO 2560
+4260 LET S = S + 4
+4270 GOTO 2560
+4280 IF K > 560 THEN 4300
+4290 GOTO 3560
+4300 LET S = S + 7
+4310 GOTO 3560
+4320 IF K > 1661 THEN 4340
+4330 GOTO 2040
+4340 LET S = S + 5
+4350 GOTO 2040
+4360 IF K > 1055 THEN 4380
+4370 GOTO 1000
+4380 LET S = S + 2
+4390 GOTO 1000
+4400 IF K > 955 THEN 4420
+4410 GOTO 3040
+4420 LET S = S + 1
+4430 GOTO 3040
+4440 IF K > 1977 THEN 4460
+4450 GOTO 1520
+4460 LET S = S + 2
+4470 GOTO 1520
+4480 IF K > 1870 THEN 4500
+4490 GOTO 3080
+4500 LET S = S + 1
+4510 GOTO 3080
+4520 IF K > 1279 THEN 4540
+4530 GOTO 1280
+4540 LET S = S + 7
+4550 GOTO 1280
+4560 IF K > 66 THEN 4580
+4570 GOTO 2240
+4580 LET S = S + 2
+4590 GOTO 2240
+4600 IF K > 753 THEN 4620
+4610 GOTO 2440
+4620 LET S = S + 5
+4630 GOTO 2440
+4640 IF K > 1113 THEN 4660
+4650 GOTO 4600
+4660 LET S = S + 4
+4670 GOTO 4600
+4680 IF K > 1159 THEN 4700
+4690 GOTO 2720
+4700 LET S = S + 5
+4710 GOTO 2720
+4720 IF K > 1763 THEN 4740
+4730 GOTO 4760
+4740 LET S = S + 5
+4750 GOTO 4760
+4760 IF K > 1305 THEN 4780
+4770 GOTO 2800
+4780 LET S = S + 6
+4790 GOTO 2800
+4800 IF K > 471 THEN 4820
+4810 GOTO 1160
+4820 LET S = S + 6
+4830 GOTO 1160
+4840 IF K > 1254 THEN 4860
+4850 GOTO 2960
+4860 LET S = S + 7
+4870 GOTO 2960
+4880 IF K > 864 THEN 4900
+4890 GOTO 2680
+4900 LET S = S + 3
+4910 GOTO 2680
+4920 IF K > 944 THEN 4940
+4930 GOTO 2920
+4940 LET S = S + 1
+4950 GOTO 2920
+4960 IF K > 1847 THEN 4980
+4970 GOTO 2120
+4980 LET S = S + 4
+4990 GOTO 2120
@@ -0,0 +1,407 @@
+1 REM Deep GOTO chain: each pass hops through 400 scattered lines
+10 LET K = 0
+20 GOTO 1610
+90 LET K = K + 1
+95 IF K < 2000 THEN 20
+97 PRINT K
+99 END
+1000 GOTO 3700
+1010 GOTO 4690
+1020 GOTO 1790
+1030 GOTO 3190
+1040 GOTO 1550
+1050 GOTO 4740
+1060 GOTO 4550
+1070 GOTO 3530
+1080 GOTO 4640
+1090 GOTO 4600
+1100 GOTO 3550
+1110 GOTO 2350
+1120 GOTO 2570
+1130 GOTO 1960
+1140 GOTO 4130
+1150 GOTO 3660
+1160 GOTO 4100
+1170 GOTO 4960
+1180 GOTO 3320
+1190 GOTO 2070
+1200 GOTO 2970
+1210 GOTO 1040
+1220 GOTO 1500
+1230 GOTO 3540
+1240 GOTO 3890
+1250 GOTO 3100
+1260 GOTO 1180
+1270 GOTO 4060
+1280 GOTO 3450
+1290 GOTO 4630
+1300 GOTO 3360
+1310 GOTO 2490
+1320 GOTO 1710
+1330 GOTO 2180
+1340 GOTO 3610
+1350 GOTO 1530
+1360 GOTO 1240
+1370 GOTO 3040
+1380 GOTO 2840
+1390 GOTO 1940
+1400 GOTO 2120
+1410 GOTO 4190
+1420 GOTO 3850
+1430 GOTO 2560
+1440 GOTO 2880
+1450 GOTO 3430
+1460 GOTO 2660
+1470 GOTO 2440
+1480 GOTO 1050
+1490 GOTO 1680
+1500 GOTO 3050
+1510 GOTO 1540
+1520 GOTO 3090
+1530 GOTO 2720
+1540 GOTO 4480
+1550 GOTO 4460
+1560 GOTO 4040
+1570 GOTO 1760
+1580 GOTO 1100
+1590 GOTO 1160
+1600 GOTO 1220
+1610 GOTO 2270
+1620 GOTO 2060
+1630 GOTO 2600
+1640 GOTO 1230
+1650 GOTO 3640
+1660 GOTO 1830
+1670 GOTO 3180
+1680 GOTO 2550
+1690 GOTO 1590
+1700 GOTO 4800
+1710 GOTO 1580
+1720 GOTO 2000
+1730 GOTO 2090
+1740 GOTO 1090
+1750 GOTO 4990
+1760 GOTO 2930
+1770 GOTO 3270
+1780 GOTO 3920
+1790 GOTO 2200
+1800 GOTO 4390
+1810 GOTO 2700
+1820 GOTO 2590
+1830 GOTO 2210
+1840 GOTO 4570
+1850 GOTO 1290
+1860 GOTO 2520
+1870 GOTO 3070
+1880 GOTO 3440
+1890 GOTO 1670
+1900 GOTO 3950
+1910 GOTO 4920
+1920 GOTO 3970
+1930 GOTO 3000
+1940 GOTO 3300
+1950 GOTO 2470
+1960 GOTO 1990
+1970 GOTO 3750
+1980 GOTO 4830
+1990 GOTO 1340
+2000 GOTO 3220
+2010 GOTO 3790
+2020 GOTO 2670
+2030 GOTO 3290
+2040 GOTO 3900
+2050 GOTO 4530
+2060 GOTO 2010
+2070 GOTO 3480
+2080 GOTO 1600
+2090 GOTO 2040
+2100 GOTO 4860
+2110 GOTO 4890
+2120 GOTO 1520
+2130 GOTO 4580
+2140 GOTO 4810
+2150 GOTO 3420
+2160 GOTO 4620
+2170 GOTO 3020
+2180 GOTO 3910
+2190 GOTO 4400
+2200 GOTO 1060
+2210 GOTO 3730
+2220 GOTO 4950
+2230 GOTO 4050
+2240 GOTO 1620
+2250 GOTO 4770
+2260 GOTO 3630
+2270 GOTO 4720
+2280 GOTO 3560
+2290 GOTO 2870
+2300 GOTO 3120
+2310 GOTO 2780
+2320 GOTO 1770
+2330 GOTO 1970
+2340 GOTO 2740
+2350 GOTO 2980
+2360 GOTO 4320
+2370 GOTO 1950
+2380 GOTO 1190
+2390 GOTO 4280
+2400 GOTO 4590
+2410 GOTO 1750
+2420 GOTO 4650
+2430 GOTO 1820
+2440 GOTO 3010
+2450 GOTO 2300
+2460 GOTO 4090
+2470 GOTO 3690
+2480 GOTO 1980
+2490 GOTO 1010
+2500 GOTO 4970
+2510 GOTO 3980
+2520 GOTO 2510
+2530 GOTO 1200
+2540 GOTO 4330
+2550 GOTO 3110
+2560 GOTO 1320
+2570 GOTO 2260
+2580 GOTO 3870
+2590 GOTO 4070
+2600 GOTO 2990
+2610 GOTO 2220
+2620 GOTO 4440
+2630 GOTO 4510
+2640 GOTO 1360
+2650 GOTO 1900
+2660 GOTO 3960
+2670 GOTO 4700
+2680 GOTO 2910
+2690 GOTO 4760
+2700 GOTO 4370
+2710 GOTO 3490
+2720 GOTO 4540
+2730 GOTO 1570
+2740 GOTO 4020
+2750 GOTO 2960
+2760 GOTO 2250
+2770 GOTO 4870
+2780 GOTO 1460
+2790 GOTO 4930
+2800 GOTO 3810
+2810 GOTO 3350
+2820 GOTO 2800
+2830 GOTO 2100
+2840 GOTO 2500
+2850 GOTO 1020
+2860 GOTO 2630
+2870 GOTO 3620
+2880 GOTO 3820
+2890 GOTO 4520
+2900 GOTO 1000
+2910 GOTO 3150
+2920 GOTO 2900
+2930 GOTO 1860
+2940 GOTO 2850
+2950 GOTO 1330
+2960 GOTO 3570
+2970 GOTO 3510
+2980 GOTO 4230
+2990 GOTO 1300
+3000 GOTO 3250
+3010 GOTO 1210
+3020 GOTO 3840
+3030 GOTO 4270
+3040 GOTO 3330
+3050 GOTO 2950
+3060 GOTO 1110
+3070 GOTO 3600
+3080 GOTO 3580
+3090 GOTO 1740
+3100 GOTO 4850
+3110 GOTO 2730
+3120 GOTO 1800
+3130 GOTO 1270
+3140 GOTO 2230
+3150 GOTO 3670
+3160 GOTO 3240
+3170 GOTO 3210
+3180 GOTO 1260
+3190 GOTO 3340
+3200 GOTO 3880
+3210 GOTO 4560
+3220 GOTO 1480
+3230 GOTO 2460
+3240 GOTO 3060
+3250 GOTO 1640
+3260 GOTO 2420
+3270 GOTO 1730
+3280 GOTO 4940
+3290 GOTO 2480
+3300 GOTO 2170
+3310 GOTO 4120
+3320 GOTO 2310
+3330 GOTO 3720
+3340 GOTO 2380
+3350 GOTO 3030
+3360 GOTO 1840
+3370 GOTO 4790
+3380 GOTO 1170
+3390 GOTO 2580
+3400 GOTO 2340
+3410 GOTO 4660
+3420 GOTO 2640
+3430 GOTO 4980
+3440 GOTO 4300
+3450 GOTO 4670
+3460 GOTO 4290
+3470 GOTO 2150
+3480 GOTO 4210
+3490 GOTO 3990
+3500 GOTO 4150
+3510 GOTO 2110
+3520 GOTO 4410
+3530 GOTO 1930
+3540 GOTO 2390
+3550 GOTO 4710
+3560 GOTO 3130
+3570 GOTO 1780
+3580 GOTO 1120
+3590 GOTO 3460
+3600 GOTO 1350
+3610 GOTO 3830
+3620 GOTO 4160
+3630 GOTO 2750
+3640 GOTO 2540
+3650 GOTO 2820
+3660 GOTO 2810
+3670 GOTO 1700
+3680 GOTO 4360
+3690 GOTO 3470
+3700 GOTO 1880
+3710 GOTO 3780
+3720 GOTO 3280
+3730 GOTO 3650
+3740 GOTO 3140
+3750 GOTO 1510
+3760 GOTO 4010
+3770 GOTO 2830
+3780 GOTO 4680
+3790 GOTO 1560
+3800 GOTO 2790
+3810 GOTO 4260
+3820 GOTO 1690
+3830 GOTO 1140
+3840 GOTO 2860
+3850 GOTO 90
+3860 GOTO 4840
+3870 GOTO 4430
+3880 GOTO 1370
+3890 GOTO 4170
+3900 GOTO 2050
+3910 GOTO 2920
+3920 GOTO 4750
+3930 GOTO 2290
+3940 GOTO 3370
+3950 GOTO 3260
+3960 GOTO 4350
+3970 GOTO 3160
+3980 GOTO 1310
+3990 GOTO 4730
+4000 GOTO 1440
+4010 GOTO 3800
+4020 GOTO 3860
+4030 GOTO 2610
+4040 GOTO 1150
+4050 GOTO 4500
+4060 GOTO 4220
+4070 GOTO 3710
+4080 GOTO 3680
+4090 GOTO 1430
+4100 GOTO 2240
+4110 GOTO 1080
+4120 GOTO 1030
+4130 GOTO 1250
+4140 GOTO 4340
+4150 GOTO 4610
+4160 GOTO 3380
+4170 GOTO 3230
+4180 GOTO 4880
+4190 GOTO 2280
+4200 GOTO 3770
+4210 GOTO 1450
+4220 GOTO 2770
+4230 GOTO 4080
+4240 GOTO 1490
+4250 GOTO 4780
+4260 GOTO 3740
+4270 GOTO 2160
+4280 GOTO 3400
+4290 GOTO 2190
+4300 GOTO 1420
+4310 GOTO 2370
+4320 GOTO 1910
+4330 GOTO 1630
+4340 GOTO 2400
+4350 GOTO 2890
+4360 GOTO 3500
+4370 GOTO 4200
+4380 GOTO 1470
+4390 GOTO 2330
+4400 GOTO 2360
+4410 GOTO 1920
+4420 GOTO 1870
+4430 GOTO 3930
+4440 GOTO 2140
+4450 GOTO 2020
+4460 GOTO 3520
+4470 GOTO 3200
+4480 GOTO 4820
+4490 GOTO 4250
+4500 GOTO 1390
+4510 GOTO 4030
+4520 GOTO 1850
+4530 GOTO 3080
+4540 GOTO 2030
+4550 GOTO 3170
+4560 GOTO 1410
+4570 GOTO 3390
+4580 GOTO 2450
+4590 GOTO 2410
+4600 GOTO 2940
+4610 GOTO 1280
+4620 GOTO 1130
+4630 GOTO 1650
+4640 GOTO 1400
+4650 GOTO 4000
+4660 GOTO 1890
+4670 GOTO 4180
+4680 GOTO 2760
+4690 GOTO 3410
+4700 GOTO 4240
+4710 GOTO 2530
+4720 GOTO 2620
+4730 GOTO 4420
+4740 GOTO 2320
+4750 GOTO 3760
+4760 GOTO 4470
+4770 GOTO 2690
+4780 GOTO 3590
+4790 GOTO 4490
+4800 GOTO 1810
+4810 GOTO 4900
+4820 GOTO 4110
+4830 GOTO 3310
+4840 GOTO 3940
+4850 GOTO 4910
+4860 GOTO 4450
+4870 GOTO 2710
+4880 GOTO 1070
+4890 GOTO 2130
+4900 GOTO 4310
+4910 GOTO 2080
+4920 GOTO 2680
+4930 GOTO 4140
+4940 GOTO 2650
+4950 GOTO 1720
+4960 GOTO 1660
+4970 GOTO 2430
+4980 GOTO 4380
+4990 GOTO 1380
@@ -0,0 +1,1358 @@
+1 REM Large program: 676 variables updated from their neighbours each pass
+10 LET N = 0
+100 LET AA = 0
+110 LET AB = 1
+120 LET AC = 2
+130 LET AD = 3
+140 LET AE = 4
+150 LET AF = 5
+160 LET AG = 6
+170 LET AH = 7
+180 LET AI = 8
+190 LET AJ = 9
+200 LET AK = 10
+210 LET AL = 11
+220 LET AM = 12
+230 LET AN = 13
+240 LET AO = 14
+250 LET AP = 15
+260 LET AQ = 16
+270 LET AR = 17
+280 LET AS = 18
+290 LET AT = 19
+300 LET AU = 20
+310 LET AV = 21
+320 LET AW = 22
+330 LET AX = 23
+340 LET AY = 24
+350 LET AZ = 25
+360 LET BA = 26
+370 LET BB = 27
+380 LET BC = 28
+390 LET BD = 29
+400 LET BE = 30
+410 LET BF = 31
+420 LET BG = 32
+430 LET BH = 33
+440 LET BI = 34
+450 LET BJ = 35
+460 LET BK = 36
+470 LET BL = 37
+480 LET BM = 38
+490 LET BN = 39
+500 LET BO = 40
+510 LET BP = 41
+520 LET BQ = 42
+530 LET BR = 43
+540 LET BS = 44
+550 LET BT = 45
+560 LET BU = 46
+570 LET BV = 47
+580 LET BW = 48
+590 LET BX = 49
+600 LET BY = 50
+610 LET BZ = 51
+620 LET CA = 52
+630 LET CB = 53
+640 LET CC = 54
+650 LET CD = 55
+660 LET CE = 56
+670 LET CF = 57
+680 LET CG = 58
+690 LET CH = 59
+700 LET CI = 60
+710 LET CJ = 61
+720 LET CK = 62
+730 LET CL = 63
+740 LET CM = 64
+750 LET CN = 65
+760 LET CO = 66
+770 LET CP = 67
+780 LET CQ = 68
+790 LET CR = 69
+800 LET CS = 70
+810 LET CT = 71
+820 LET CU = 72
+830 LET CV = 73
+840 LET CW = 74
+850 LET CX = 75
+860 LET CY = 76
+870 LET CZ = 77
+880 LET DA = 78
+890 LET DB = 79
+900 LET DC = 80
+910 LET DD = 81
+920 LET DE = 82
+930 LET DF = 83
+940 LET DG = 84
+950 LET DH = 85
+960 LET DI = 86
+970 LET DJ = 87
+980 LET DK = 88
+990 LET DL = 89
+1000 LET DM = 90
+1010 LET DN = 91
+1020 LET DO = 92
+1030 LET DP = 93
+1040 LET DQ = 94
+1050 LET DR = 95
+1060 LET DS = 96
+1070 LET DT = 97
+1080 LET DU = 98
+1090 LET DV = 99
+1100 LET DW = 100
+1110 LET DX = 101
+1120 LET DY = 102
+1130 LET DZ = 103
+1140 LET EA = 104
+1150 LET EB = 105
+1160 LET EC = 106
+1170 LET ED = 107
+1180 LET EE = 108
+1190 LET EF = 109
+1200 LET EG = 110
+1210 LET EH = 111
+1220 LET EI = 112
+1230 LET EJ = 113
+1240 LET EK = 114
+1250 LET EL = 115
+1260 LET EM = 116
+1270 LET EN = 117
+1280 LET EO = 118
+1290 LET EP = 119
+1300 LET EQ = 120
+1310 LET ER = 121
+1320 LET ES = 122
+1330 LET ET = 123
+1340 LET EU = 124
+1350 LET EV = 125
+1360 LET EW = 126
+1370 LET EX = 127
+1380 LET EY = 128
+1390 LET EZ = 129
+1400 LET FA = 130
+1410 LET FB = 131
+1420 LET FC = 132
+1430 LET FD = 133
+1440 LET FE = 134
+1450 LET FF = 135
+1460 LET FG = 136
+1470 LET FH = 137
+1480 LET FI = 138
+1490 LET FJ = 139
+1500 LET FK = 140
+1510 LET FL = 141
+1520 LET FM = 142
+1530 LET FN = 143
+1540 LET FO = 144
+1550 LET FP = 145
+1560 LET FQ = 146
+1570 LET FR = 147
+1580 LET FS = 148
+1590 LET FT = 149
+1600 LET FU = 150
+1610 LET FV = 151
+1620 LET FW = 152
+1630 LET FX = 153
+1640 LET FY = 154
+1650 LET FZ = 155
+1660 LET GA = 156
+1670 LET GB = 157
+1680 LET GC = 158
+1690 LET GD = 159
+1700 LET GE = 160
+1710 LET GF = 161
+1720 LET GG = 162
+1730 LET GH = 163
+1740 LET GI = 164
+1750 LET GJ = 165
+1760 LET GK = 166
+1770 LET GL = 167
+1780 LET GM = 168
+1790 LET GN = 169
+1800 LET GO = 170
+1810 LET GP = 171
+1820 LET GQ = 172
+1830 LET GR = 173
+1840 LET GS = 174
+1850 LET GT = 175
+1860 LET GU = 176
+1870 LET GV = 177
+1880 LET GW = 178
+1890 LET GX = 179
+1900 LET GY = 180
+1910 LET GZ = 181
+1920 LET HA = 182
+1930 LET HB = 183
+1940 LET HC = 184
+1950 LET HD = 185
+1960 LET HE = 186
+1970 LET HF = 187
+1980 LET HG = 188
+1990 LET HH = 189
+2000 LET HI = 190
+2010 LET HJ = 191
+2020 LET HK = 192
+2030 LET HL = 193
+2040 LET HM = 194
+2050 LET HN = 195
+2060 LET HO = 196
+2070 LET HP = 197
+2080 LET HQ = 198
+2090 LET HR = 199
+2100 LET HS = 200
+2110 LET HT = 201
+2120 LET HU = 202
+2130 LET HV = 203
+2140 LET HW = 204
+2150 LET HX = 205
+2160 LET HY = 206
+2170 LET HZ = 207
+2180 LET IA = 208
+2190 LET IB = 209
+2200 LET IC = 210
+2210 LET ID = 211
+2220 LET IE = 212
+2230 LET IFF = 213
+2240 LET IG = 214
+2250 LET IH = 215
+2260 LET II = 216
+2270 LET IJ = 217
+2280 LET IK = 218
+2290 LET IL = 219
+2300 LET IM = 220
+2310 LET IN = 221
+2320 LET IO = 222
+2330 LET IP = 223
+2340 LET IQ = 224
+2350 LET IR = 225
+2360 LET IS = 226
+2370 LET IT = 227
+2380 LET IU = 228
+2390 LET IV = 229
+2400 LET IW = 230
+2410 LET IX = 231
+2420 LET IY = 232
+2430 LET IZ = 233
+2440 LET JA = 234
+2450 LET JB = 235
+2460 LET JC = 236
+2470 LET JD = 237
+2480 LET JE = 238
+2490 LET JF = 239
+2500 LET JG = 240
+2510 LET JH = 241
+2520 LET JI = 242
+2530 LET JJ = 243
+2540 LET JK = 244
+2550 LET JL = 245
+2560 LET JM = 246
+2570 LET JN = 247
+2580 LET JO = 248
+2590 LET JP = 249
+2600 LET JQ = 250
+2610 LET JR = 251
+2620 LET JS = 252
+2630 LET JT = 253
+2640 LET JU = 254
+2650 LET JV = 255
+2660 LET JW = 256
+2670 LET JX = 257
+2680 LET JY = 258
+2690 LET JZ = 259
+2700 LET KA = 260
+2710 LET KB = 261
+2720 LET KC = 262
+2730 LET KD = 263
+2740 LET KE = 264
+2750 LET KF = 265
+2760 LET KG = 266
+2770 LET KH = 267
+2780 LET KI = 268
+2790 LET KJ = 269
+2800 LET KK = 270
+2810 LET KL = 271
+2820 LET KM = 272
+2830 LET KN = 273
+2840 LET KO = 274
+2850 LET KP = 275
+2860 LET KQ = 276
+2870 LET KR = 277
+2880 LET KS = 278
+2890 LET KT = 279
+2900 LET KU = 280
+2910 LET KV = 281
+2920 LET KW = 282
+2930 LET KX = 283
+2940 LET KY = 284
+2950 LET KZ = 285
+2960 LET LA = 286
+2970 LET LB = 287
+2980 LET LC = 288
+2990 LET LD = 289
+3000 LET LE = 290
+3010 LET LF = 291
+3020 LET LG = 292
+3030 LET LH = 293
+3040 LET LI = 294
+3050 LET LJ = 295
+3060 LET LK = 296
+3070 LET LL = 297
+3080 LET LM = 298
+3090 LET LN = 299
+3100 LET LO = 300
+3110 LET LP = 301
+3120 LET LQ = 302
+3130 LET LR = 303
+3140 LET LS = 304
+3150 LET LT = 305
+3160 LET LU = 306
+3170 LET LV = 307
+3180 LET LW = 308
+3190 LET LX = 309
+3200 LET LY = 310
+3210 LET LZ = 311
+3220 LET MA = 312
+3230 LET MB = 313
+3240 LET MC = 314
+3250 LET MD = 315
+3260 LET ME = 316
+3270 LET MF = 317
+3280 LET MG = 318
+3290 LET MH = 319
+3300 LET MI = 320
+3310 LET MJ = 321
+3320 LET MK = 322
+3330 LET ML = 323
+3340 LET MM = 324
+3350 LET MN = 325
+3360 LET MO = 326
+3370 LET MP = 327
+3380 LET MQ = 328
+3390 LET MR = 329
+3400 LET MS = 330
+3410 LET MT = 331
+3420 LET MU = 332
+3430 LET MV = 333
+3440 LET MW = 334
+3450 LET MX = 335
+3460 LET MY = 336
+3470 LET MZ = 337
+3480 LET NA = 338
+3490 LET NB = 339
+3500 LET NC = 340
+3510 LET ND = 341
+3520 LET NE = 342
+3530 LET NF = 343
+3540 LET NG = 344
+3550 LET NH = 345
+3560 LET NI = 346
+3570 LET NJ = 347
+3580 LET NK = 348
+3590 LET NL = 349
+3600 LET NM = 350
+3610 LET NN = 351
+3620 LET NO = 352
+3630 LET NP = 353
+3640 LET NQ = 354
+3650 LET NR = 355
+3660 LET NS = 356
+3670 LET NT = 357
+3680 LET NU = 358
+3690 LET NV = 359
+3700 LET NW = 360
+3710 LET NX = 361
+3720 LET NY = 362
+3730 LET NZ = 363
+3740 LET OA = 364
+3750 LET OB = 365
+3760 LET OC = 366
+3770 LET OD = 367
+3780 LET OE = 368
+3790 LET OF = 369
+3800 LET OG = 370
+3810 LET OH = 371
+3820 LET OI = 372
+3830 LET OJ = 373
+3840 LET OK = 374
+3850 LET OL = 375
+3860 LET OM = 376
+3870 LET ON = 377
+3880 LET OO = 378
+3890 LET OP = 379
+3900 LET OQ = 380
+3910 LET OR = 381
+3920 LET OS = 382
+3930 LET OT = 383
+3940 LET OU = 384
+3950 LET OV = 385
+3960 LET OW = 386
+3970 LET OX = 387
+3980 LET OY = 388
+3990 LET OZ = 389
+4000 LET PA = 390
+4010 LET PB = 391
+4020 LET PC = 392
+4030 LET PD = 393
+4040 LET PE = 394
+4050 LET PF = 395
+4060 LET PG = 396
+4070 LET PH = 397
+4080 LET PI = 398
+4090 LET PJ = 399
+4100 LET PK = 400
+4110 LET PL = 401
+4120 LET PM = 402
+4130 LET PN = 403
+4140 LET PO = 404
+4150 LET PP = 405
+4160 LET PQ = 406
+4170 LET PR = 407
+4180 LET PS = 408
+4190 LET PT = 409
+4200 LET PU = 410
+4210 LET PV = 411
+4220 LET PW = 412
+4230 LET PX = 413
+4240 LET PY = 414
+4250 LET PZ = 415
+4260 LET QA = 416
+4270 LET QB = 417
+4280 LET QC = 418
+4290 LET QD = 419
+4300 LET QE = 420
+4310 LET QF = 421
+4320 LET QG = 422
+4330 LET QH = 423
+4340 LET QI = 424
+4350 LET QJ = 425
+4360 LET QK = 426
+4370 LET QL = 427
+4380 LET QM = 428
+4390 LET QN = 429
+4400 LET QO = 430
+4410 LET QP = 431
+4420 LET QQ = 432
+4430 LET QR = 433
+4440 LET QS = 434
+4450 LET QT = 435
+4460 LET QU = 436
+4470 LET QV = 437
+4480 LET QW = 438
+4490 LET QX = 439
+4500 LET QY = 440
+4510 LET QZ = 441
+4520 LET RA = 442
+4530 LET RB = 443
+4540 LET RC = 444
+4550 LET RD = 445
+4560 LET RE = 446
+4570 LET RF = 447
+4580 LET RG = 448
+4590 LET RH = 449
+4600 LET RI = 450
+4610 LET RJ = 451
+4620 LET RK = 452
+4630 LET RL = 453
+4640 LET RM = 454
+4650 LET RN = 455
+4660 LET RO = 456
+4670 LET RP = 457
+4680 LET RQ = 458
+4690 LET RR = 459
+4700 LET RS = 460
+4710 LET RT = 461
+4720 LET RU = 462
+4730 LET RV = 463
+4740 LET RW = 464
+4750 LET RX = 465
+4760 LET RY = 466
+4770 LET RZ = 467
+4780 LET SA = 468
+4790 LET SB = 469
+4800 LET SC = 470
+4810 LET SD = 471
+4820 LET SE = 472
+4830 LET SF = 473
+4840 LET SG = 474
+4850 LET SH = 475
+4860 LET SI = 476
+4870 LET SJ = 477
+4880 LET SK = 478
+4890 LET SL = 479
+4900 LET SM = 480
+4910 LET SN = 481
+4920 LET SO = 482
+4930 LET SP = 483
+4940 LET SQ = 484
+4950 LET SR = 485
+4960 LET SS = 486
+4970 LET ST = 487
+4980 LET SU = 488
+4990 LET SV = 489
+5000 LET SW = 490
+5010 LET SX = 491
+5020 LET SY = 492
+5030 LET SZ = 493
+5040 LET TA = 494
+5050 LET TB = 495
+5060 LET TC = 496
+5070 LET TD = 497
+5080 LET TE = 498
+5090 LET TF = 499
+5100 LET TG = 500
+5110 LET TH = 501
+5120 LET TI = 502
+5130 LET TJ = 503
+5140 LET TK = 504
+5150 LET TL = 505
+5160 LET TM = 506
+5170 LET TN = 507
+5180 LET TO = 508
+5190 LET TP = 509
+5200 LET TQ = 510
+5210 LET TR = 511
+5220 LET TS = 512
+5230 LET TT = 513
+5240 LET TU = 514
+5250 LET TV = 515
+5260 LET TW = 516
+5270 LET TX = 517
+5280 LET TY = 518
+5290 LET TZ = 519
+5300 LET UA = 520
+5310 LET UB = 521
+5320 LET UC = 522
+5330 LET UD = 523
+5340 LET UE = 524
+5350 LET UF = 525
+5360 LET UG = 526
+5370 LET UH = 527
+5380 LET UI = 528
+5390 LET UJ = 529
+5400 LET UK = 530
+5410 LET UL = 531
+5420 LET UM = 532
+5430 LET UN = 533
+5440 LET UO = 534
+5450 LET UP = 535
+5460 LET UQ = 536
+5470 LET UR = 537
+5480 LET US = 538
+5490 LET UT = 539
+5500 LET UU = 540
+5510 LET UV = 541
+5520 LET UW = 542
+5530 LET UX = 543
+5540 LET UY = 544
+5550 LET UZ = 545
+5560 LET VA = 546
+5570 LET VB = 547
+5580 LET VC = 548
+5590 LET VD = 549
+5600 LET VE = 550
+5610 LET VF = 551
+5620 LET VG = 552
+5630 LET VH = 553
+5640 LET VI = 554
+5650 LET VJ = 555
+5660 LET VK = 556
+5670 LET VL = 557
+5680 LET VM = 558
+5690 LET VN = 559
+5700 LET VO = 560
+5710 LET VP = 561
+5720 LET VQ = 562
+5730 LET VR = 563
+5740 LET VS = 564
+5750 LET VT = 565
+5760 LET VU = 566
+5770 LET VV = 567
+5780 LET VW = 568
+5790 LET VX = 569
+5800 LET VY = 570
+5810 LET VZ = 571
+5820 LET WA = 572
+5830 LET WB = 573
+5840 LET WC = 574
+5850 LET WD = 575
+5860 LET WE = 576
+5870 LET WF = 577
+5880 LET WG = 578
+5890 LET WH = 579
+5900 LET WI = 580
+5910 LET WJ = 581
+5920 LET WK = 582
+5930 LET WL = 583
+5940 LET WM = 584
+5950 LET WN = 585
+5960 LET WO = 586
+5970 LET WP = 587
+5980 LET WQ = 588
+5990 LET WR = 589
+6000 LET WS = 590
+6010 LET WT = 591
+6020 LET WU = 592
+6030 LET WV = 593
+6040 LET WW = 594
+6050 LET WX = 595
+6060 LET WY = 596
+6070 LET WZ = 597
+6080 LET XA = 598
+6090 LET XB = 599
+6100 LET XC = 600
+6110 LET XD = 601
+6120 LET XE = 602
+6130 LET XF = 603
+6140 LET XG = 604
+6150 LET XH = 605
+6160 LET XI = 606
+6170 LET XJ = 607
+6180 LET XK = 608
+6190 LET XL = 609
+6200 LET XM = 610
+6210 LET XN = 611
+6220 LET XO = 612
+6230 LET XP = 613
+6240 LET XQ = 614
+6250 LET XR = 615
+6260 LET XS = 616
+6270 LET XT = 617
+6280 LET XU = 618
+6290 LET XV = 619
+6300 LET XW = 620
+6310 LET XX = 621
+6320 LET XY = 622
+6330 LET XZ = 623
+6340 LET YA = 624
+6350 LET YB = 625
+6360 LET YC = 626
+6370 LET YD = 627
+6380 LET YE = 628
+6390 LET YF = 629
+6400 LET YG = 630
+6410 LET YH = 631
+6420 LET YI = 632
+6430 LET YJ = 633
+6440 LET YK = 634
+6450 LET YL = 635
+6460 LET YM = 636
+6470 LET YN = 637
+6480 LET YO = 638
+6490 LET YP = 639
+6500 LET YQ = 640
+6510 LET YR = 641
+6520 LET YS = 642
+6530 LET YT = 643
+6540 LET YU = 644
+6550 LET YV = 645
+6560 LET YW = 646
+6570 LET YX = 647
+6580 LET YY = 648
+6590 LET YZ = 649
+6600 LET ZA = 650
+6610 LET ZB = 651
+6620 LET ZC = 652
+6630 LET ZD = 653
+6640 LET ZE = 654
+6650 LET ZF = 655
+6660 LET ZG = 656
+6670 LET ZH = 657
+6680 LET ZI = 658
+6690 LET ZJ = 659
+6700 LET ZK = 660
+6710 LET ZL = 661
+6720 LET ZM = 662
+6730 LET ZN = 663
+6740 LET ZO = 664
+6750 LET ZP = 665
+6760 LET ZQ = 666
+6770 LET ZR = 667
+6780 LET ZS = 668
+6790 LET ZT = 669
+6800 LET ZU = 670
+6810 LET ZV = 671
+6820 LET ZW = 672
+6830 LET ZX = 673
+6840 LET ZY = 674
+6850 LET ZZ = 675
+6860 LET AA = AA + ZZ / 3 - N
+6870 LET AB = AB + AA / 3 - N
+6880 LET AC = AC + AB / 3 - N
+6890 LET AD = AD + AC / 3 - N
+6900 LET AE = AE + AD / 3 - N
+6910 LET AF = AF + AE / 3 - N
+6920 LET AG = AG + AF / 3 - N
+6930 LET AH = AH + AG / 3 - N
+6940 LET AI = AI + AH / 3 - N
+6950 LET AJ = AJ + AI / 3 - N
+6960 LET AK = AK + AJ / 3 - N
+6970 LET AL = AL + AK / 3 - N
+6980 LET AM = AM + AL / 3 - N
+6990 LET AN = AN + AM / 3 - N
+7000 LET AO = AO + AN / 3 - N
+7010 LET AP = AP + AO / 3 - N
+7020 LET AQ = AQ + AP / 3 - N
+7030 LET AR = AR + AQ / 3 - N
+7040 LET AS = AS + AR / 3 - N
+7050 LET AT = AT + AS / 3 - N
+7060 LET AU = AU + AT / 3 - N
+7070 LET AV = AV + AU / 3 - N
+7080 LET AW = AW + AV / 3 - N
+7090 LET AX = AX + AW / 3 - N
+7100 LET AY = AY + AX / 3 - N
+7110 LET AZ = AZ + AY / 3 - N
+7120 LET BA = BA + AZ / 3 - N
+7130 LET BB = BB + BA / 3 - N
+7140 LET BC = BC + BB / 3 - N
+7150 LET BD = BD + BC / 3 - N
+7160 LET BE = BE + BD / 3 - N
+7170 LET BF = BF + BE / 3 - N
+7180 LET BG = BG + BF / 3 - N
+7190 LET BH = BH + BG / 3 - N
+7200 LET BI = BI + BH / 3 - N
+7210 LET BJ = BJ + BI / 3 - N
+7220 LET BK = BK + BJ / 3 - N
+7230 LET BL = BL + BK / 3 - N
+7240 LET BM = BM + BL / 3 - N
+7250 LET BN = BN + BM / 3 - N
+7260 LET BO = BO + BN / 3 - N
+7270 LET BP = BP + BO / 3 - N
+7280 LET BQ = BQ + BP / 3 - N
+7290 LET BR = BR + BQ / 3 - N
+7300 LET BS = BS + BR / 3 - N
+7310 LET BT = BT + BS / 3 - N
+7320 LET BU = BU + BT / 3 - N
+7330 LET BV = BV + BU / 3 - N
+7340 LET BW = BW + BV / 3 - N
+7350 LET BX = BX + BW / 3 - N
+7360 LET BY = BY + BX / 3 - N
+7370 LET BZ = BZ + BY / 3 - N
+7380 LET CA = CA + BZ / 3 - N
+7390 LET CB = CB + CA / 3 - N
+7400 LET CC = CC + CB / 3 - N
+7410 LET CD = CD + CC / 3 - N
+7420 LET CE = CE + CD / 3 - N
+7430 LET CF = CF + CE / 3 - N
+7440 LET CG = CG + CF / 3 - N
+7450 LET CH = CH + CG / 3 - N
+7460 LET CI = CI + CH / 3 - N
+7470 LET CJ = CJ + CI / 3 - N
+7480 LET CK = CK + CJ / 3 - N
+7490 LET CL = CL + CK / 3 - N
+7500 LET CM = CM + CL / 3 - N
+7510 LET CN = CN + CM / 3 - N
+7520 LET CO = CO + CN / 3 - N
+7530 LET CP = CP + CO / 3 - N
+7540 LET CQ = CQ + CP / 3 - N
+7550 LET CR = CR + CQ / 3 - N
+7560 LET CS = CS + CR / 3 - N
+7570 LET CT = CT + CS / 3 - N
+7580 LET CU = CU + CT / 3 - N
+7590 LET CV = CV + CU / 3 - N
+7600 LET CW = CW + CV / 3 - N
+7610 LET CX = CX + CW / 3 - N
+7620 LET CY = CY + CX / 3 - N
+7630 LET CZ = CZ + CY / 3 - N
+7640 LET DA = DA + CZ / 3 - N
+7650 LET DB = DB + DA / 3 - N
+7660 LET DC = DC + DB / 3 - N
+7670 LET DD = DD + DC / 3 - N
+7680 LET DE = DE + DD / 3 - N
+7690 LET DF = DF + DE / 3 - N
+7700 LET DG = DG + DF / 3 - N
+7710 LET DH = DH + DG / 3 - N
+7720 LET DI = DI + DH / 3 - N
+7730 LET DJ = DJ + DI / 3 - N
+7740 LET DK = DK + DJ / 3 - N
+7750 LET DL = DL + DK / 3 - N
+7760 LET DM = DM + DL / 3 - N
+7770 LET DN = DN + DM / 3 - N
+7780 LET DO = DO + DN / 3 - N
+7790 LET DP = DP + DO / 3 - N
+7800 LET DQ = DQ + DP / 3 - N
+7810 LET DR = DR + DQ / 3 - N
+7820 LET DS = DS + DR / 3 - N
+7830 LET DT = DT + DS / 3 - N
+7840 LET DU = DU + DT / 3 - N
+7850 LET DV = DV + DU / 3 - N
+7860 LET DW = DW + DV / 3 - N
+7870 LET DX = DX + DW / 3 - N
+7880 LET DY = DY + DX / 3 - N
+7890 LET DZ = DZ + DY / 3 - N
+7900 LET EA = EA + DZ / 3 - N
+7910 LET EB = EB + EA / 3 - N
+7920 LET EC = EC + EB / 3 - N
+7930 LET ED = ED + EC / 3 - N
+7940 LET EE = EE + ED / 3 - N
+7950 LET EF = EF + EE / 3 - N
+7960 LET EG = EG + EF / 3 - N
+7970 LET EH = EH + EG / 3 - N
+7980 LET EI = EI + EH / 3 - N
+7990 LET EJ = EJ + EI / 3 - N
+8000 LET EK = EK + EJ / 3 - N
+8010 LET EL = EL + EK / 3 - N
+8020 LET EM = EM + EL / 3 - N
+8030 LET EN = EN + EM / 3 - N
+8040 LET EO = EO + EN / 3 - N
+8050 LET EP = EP + EO / 3 - N
+8060 LET EQ = EQ + EP / 3 - N
+8070 LET ER = ER + EQ / 3 - N
+8080 LET ES = ES + ER / 3 - N
+8090 LET ET = ET + ES / 3 - N
+8100 LET EU = EU + ET / 3 - N
+8110 LET EV = EV + EU / 3 - N
+8120 LET EW = EW + EV / 3 - N
+8130 LET EX = EX + EW / 3 - N
+8140 LET EY = EY + EX / 3 - N
+8150 LET EZ = EZ + EY / 3 - N
+8160 LET FA = FA + EZ / 3 - N
+8170 LET FB = FB + FA / 3 - N
+8180 LET FC = FC + FB / 3 - N
+8190 LET FD = FD + FC / 3 - N
+8200 LET FE = FE + FD / 3 - N
+8210 LET FF = FF + FE / 3 - N
+8220 LET FG = FG + FF / 3 - N
+8230 LET FH = FH + FG / 3 - N
+8240 LET FI = FI + FH / 3 - N
+8250 LET FJ = FJ + FI / 3 - N
+8260 LET FK = FK + FJ / 3 - N
+8270 LET FL = FL + FK / 3 - N
+8280 LET FM = FM + FL / 3 - N
+8290 LET FN = FN + FM / 3 - N
+8300 LET FO = FO + FN / 3 - N
+8310 LET FP = FP + FO / 3 - N
+8320 LET FQ = FQ + FP / 3 - N
+8330 LET FR = FR + FQ / 3 - N
+8340 LET FS = FS + FR / 3 - N
+8350 LET FT = FT + FS / 3 - N
+8360 LET FU = FU + FT / 3 - N
+8370 LET FV = FV + FU / 3 - N
+8380 LET FW = FW + FV / 3 - N
+8390 LET FX = FX + FW / 3 - N
+8400 LET FY = FY + FX / 3 - N
+8410 LET FZ = FZ + FY / 3 - N
+8420 LET GA = GA + FZ / 3 - N
+8430 LET GB = GB + GA / 3 - N
+8440 LET GC = GC + GB / 3 - N
+8450 LET GD = GD + GC / 3 - N
+8460 LET GE = GE + GD / 3 - N
+8470 LET GF = GF + GE / 3 - N
+8480 LET GG = GG + GF / 3 - N
+8490 LET GH = GH + GG / 3 - N
+8500 LET GI = GI + GH / 3 - N
+8510 LET GJ = GJ + GI / 3 - N
+8520 LET GK = GK + GJ / 3 - N
+8530 LET GL = GL + GK / 3 - N
+8540 LET GM = GM + GL / 3 - N
+8550 LET GN = GN + GM / 3 - N
+8560 LET GO = GO + GN / 3 - N
+8570 LET GP = GP + GO / 3 - N
+8580 LET GQ = GQ + GP / 3 - N
+8590 LET GR = GR + GQ / 3 - N
+8600 LET GS = GS + GR / 3 - N
+8610 LET GT = GT + GS / 3 - N
+8620 LET GU = GU + GT / 3 - N
+8630 LET GV = GV + GU / 3 - N
+8640 LET GW = GW + GV / 3 - N
+8650 LET GX = GX + GW / 3 - N
+8660 LET GY = GY + GX / 3 - N
+8670 LET GZ = GZ + GY / 3 - N
+8680 LET HA = HA + GZ / 3 - N
+8690 LET HB = HB + HA / 3 - N
+8700 LET HC = HC + HB / 3 - N
+8710 LET HD = HD + HC / 3 - N
+8720 LET HE = HE + HD / 3 - N
+8730 LET HF = HF + HE / 3 - N
+8740 LET HG = HG + HF / 3 - N
+8750 LET HH = HH + HG / 3 - N
+8760 LET HI = HI + HH / 3 - N
+8770 LET HJ = HJ + HI / 3 - N
+8780 LET HK = HK + HJ / 3 - N
+8790 LET HL = HL + HK / 3 - N
+8800 LET HM = HM + HL / 3 - N
+8810 LET HN = HN + HM / 3 - N
+8820 LET HO = HO + HN / 3 - N
+8830 LET HP = HP + HO / 3 - N
+8840 LET HQ = HQ + HP / 3 - N
+8850 LET HR = HR + HQ / 3 - N
+8860 LET HS = HS + HR / 3 - N
+8870 LET HT = HT + HS / 3 - N
+8880 LET HU = HU + HT / 3 - N
+8890 LET HV = HV + HU / 3 - N
+8900 LET HW = HW + HV / 3 - N
+8910 LET HX = HX + HW / 3 - N
+8920 LET HY = HY + HX / 3 - N
+8930 LET HZ = HZ + HY / 3 - N
+8940 LET IA = IA + HZ / 3 - N
+8950 LET IB = IB + IA / 3 - N
+8960 LET IC = IC + IB / 3 - N
+8970 LET ID = ID + IC / 3 - N
+8980 LET IE = IE + ID / 3 - N
+8990 LET IFF = IFF + IE / 3 - N
+9000 LET IG = IG + IFF / 3 - N
+9010 LET IH = IH + IG / 3 - N
+9020 LET II = II + IH / 3 - N
+9030 LET IJ = IJ + II / 3 - N
+9040 LET IK = IK + IJ / 3 - N
+9050 LET IL = IL + IK / 3 - N
+9060 LET IM = IM + IL / 3 - N
+9070 LET IN = IN + IM / 3 - N
+9080 LET IO = IO + IN / 3 - N
+9090 LET IP = IP + IO / 3 - N
+9100 LET IQ = IQ + IP / 3 - N
+9110 LET IR = IR + IQ / 3 - N
+9120 LET IS = IS + IR / 3 - N
+9130 LET IT = IT + IS / 3 - N
+9140 LET IU = IU + IT / 3 - N
+9150 LET IV = IV + IU / 3 - N
+9160 LET IW = IW + IV / 3 - N
+9170 LET IX = IX + IW / 3 - N
+9180 LET IY = IY + IX / 3 - N
+9190 LET IZ = IZ + IY / 3 - N
+9200 LET JA = JA + IZ / 3 - N
+9210 LET JB = JB + JA / 3 - N
+9220 LET JC = JC + JB / 3 - N
+9230 LET JD = JD + JC / 3 - N
+9240 LET JE = JE + JD / 3 - N
+9250 LET JF = JF + JE / 3 - N
+9260 LET JG = JG + JF / 3 - N
+9270 LET JH = JH + JG / 3 - N
+9280 LET JI = JI + JH / 3 - N
+9290 LET JJ = JJ + JI / 3 - N
+9300 LET JK = JK + JJ / 3 - N
+9310 LET JL = JL + JK / 3 - N
+9320 LET JM = JM + JL / 3 - N
+9330 LET JN = JN + JM / 3 - N
+9340 LET JO = JO + JN / 3 - N
+9350 LET JP = JP + JO / 3 - N
+9360 LET JQ = JQ + JP / 3 - N
+9370 LET JR = JR + JQ / 3 - N
+9380 LET JS = JS + JR / 3 - N
+9390 LET JT = JT + JS / 3 - N
+9400 LET JU = JU + JT / 3 - N
+9410 LET JV = JV + JU / 3 - N
+9420 LET JW = JW + JV / 3 - N
+9430 LET JX = JX + JW / 3 - N
+9440 LET JY = JY + JX / 3 - N
+9450 LET JZ = JZ + JY / 3 - N
+9460 LET KA = KA + JZ / 3 - N
+9470 LET KB = KB + KA / 3 - N
+9480 LET KC = KC + KB / 3 - N
+9490 LET KD = KD + KC / 3 - N
+9500 LET KE = KE + KD / 3 - N
+9510 LET KF = KF + KE / 3 - N
+9520 LET KG = KG + KF / 3 - N
+9530 LET KH = KH + KG / 3 - N
+9540 LET KI = KI + KH / 3 - N
+9550 LET KJ = KJ + KI / 3 - N
+9560 LET KK = KK + KJ / 3 - N
+9570 LET KL = KL + KK / 3 - N
+9580 LET KM = KM + KL / 3 - N
+9590 LET KN = KN + KM / 3 - N
+9600 LET KO = KO + KN / 3 - N
+9610 LET KP = KP + KO / 3 - N
+9620 LET KQ = KQ + KP / 3 - N
+9630 LET KR = KR + KQ / 3 - N
+9640 LET KS = KS + KR / 3 - N
+9650 LET KT = KT + KS / 3 - N
+9660 LET KU = KU + KT / 3 - N
+9670 LET KV = KV + KU / 3 - N
+9680 LET KW = KW + KV / 3 - N
+9690 LET KX = KX + KW / 3 - N
+9700 LET KY = KY + KX / 3 - N
+9710 LET KZ = KZ + KY / 3 - N
+9720 LET LA = LA + KZ / 3 - N
+9730 LET LB = LB + LA / 3 - N
+9740 LET LC = LC + LB / 3 - N
+9750 LET LD = LD + LC / 3 - N
+9760 LET LE = LE + LD / 3 - N
+9770 LET LF = LF + LE / 3 - N
+9780 LET LG = LG + LF / 3 - N
+9790 LET LH = LH + LG / 3 - N
+9800 LET LI = LI + LH / 3 - N
+9810 LET LJ = LJ + LI / 3 - N
+9820 LET LK = LK + LJ / 3 - N
+9830 LET LL = LL + LK / 3 - N
+9840 LET LM = LM + LL / 3 - N
+9850 LET LN = LN + LM / 3 - N
+9860 LET LO = LO + LN / 3 - N
+9870 LET LP = LP + LO / 3 - N
+9880 LET LQ = LQ + LP / 3 - N
+9890 LET LR = LR + LQ / 3 - N
+9900 LET LS = LS + LR / 3 - N
+9910 LET LT = LT + LS / 3 - N
+9920 LET LU = LU + LT / 3 - N
+9930 LET LV = LV + LU / 3 - N
+9940 LET LW = LW + LV / 3 - N
+9950 LET LX = LX + LW / 3 - N
+9960 LET LY = LY + LX / 3 - N
+9970 LET LZ = LZ + LY / 3 - N
+9980 LET MA = MA + LZ / 3 - N
+9990 LET MB = MB + MA / 3 - N
+10000 LET MC = MC + MB / 3 - N
+10010 LET MD = MD + MC / 3 - N
+10020 LET ME = ME + MD / 3 - N
+10030 LET MF = MF + ME / 3 - N
+10040 LET MG = MG + MF / 3 - N
+10050 LET MH = MH + MG / 3 - N
+10060 LET MI = MI + MH / 3 - N
+10070 LET MJ = MJ + MI / 3 - N
+10080 LET MK = MK + MJ / 3 - N
+10090 LET ML = ML + MK / 3 - N
+10100 LET MM = MM + ML / 3 - N
+10110 LET MN = MN + MM / 3 - N
+10120 LET MO = MO + MN / 3 - N
+10130 LET MP = MP + MO / 3 - N
+10140 LET MQ = MQ + MP / 3 - N
+10150 LET MR = MR + MQ / 3 - N
+10160 LET MS = MS + MR / 3 - N
+10170 LET MT = MT + MS / 3 - N
+10180 LET MU = MU + MT / 3 - N
+10190 LET MV = MV + MU / 3 - N
+10200 LET MW = MW + MV / 3 - N
+10210 LET MX = MX + MW / 3 - N
+10220 LET MY = MY + MX / 3 - N
+10230 LET MZ = MZ + MY / 3 - N
+10240 LET NA = NA + MZ / 3 - N
+10250 LET NB = NB + NA / 3 - N
+10260 LET NC = NC + NB / 3 - N
+10270 LET ND = ND + NC / 3 - N
+10280 LET NE = NE + ND / 3 - N
+10290 LET NF = NF + NE / 3 - N
+10300 LET NG = NG + NF / 3 - N
+10310 LET NH = NH + NG / 3 - N
+10320 LET NI = NI + NH / 3 - N
+10330 LET NJ = NJ + NI / 3 - N
+10340 LET NK = NK + NJ / 3 - N
+10350 LET NL = NL + NK / 3 - N
+10360 LET NM = NM + NL / 3 - N
+10370 LET NN = NN + NM / 3 - N
+10380 LET NO = NO + NN / 3 - N
+10390 LET NP = NP + NO / 3 - N
+10400 LET NQ = NQ + NP / 3 - N
+10410 LET NR = NR + NQ / 3 - N
+10420 LET NS = NS + NR / 3 - N
+10430 LET NT = NT + NS / 3 - N
+10440 LET NU = NU + NT / 3 - N
+10450 LET NV = NV + NU / 3 - N
+10460 LET NW = NW + NV / 3 - N
+10470 LET NX = NX + NW / 3 - N
+10480 LET NY = NY + NX / 3 - N
+10490 LET NZ = NZ + NY / 3 - N
+10500 LET OA = OA + NZ / 3 - N
+10510 LET OB = OB + OA / 3 - N
+10520 LET OC = OC + OB / 3 - N
+10530 LET OD = OD + OC / 3 - N
+10540 LET OE = OE + OD / 3 - N
+10550 LET OF = OF + OE / 3 - N
+10560 LET OG = OG + OF / 3 - N
+10570 LET OH = OH + OG / 3 - N
+10580 LET OI = OI + OH / 3 - N
+10590 LET OJ = OJ + OI / 3 - N
+10600 LET OK = OK + OJ / 3 - N
+10610 LET OL = OL + OK / 3 - N
+10620 LET OM = OM + OL / 3 - N
+10630 LET ON = ON + OM / 3 - N
+10640 LET OO = OO + ON / 3 - N
+10650 LET OP = OP + OO / 3 - N
+10660 LET OQ = OQ + OP / 3 - N
+10670 LET OR = OR + OQ / 3 - N
+10680 LET OS = OS + OR / 3 - N
+10690 LET OT = OT + OS / 3 - N
+10700 LET OU = OU + OT / 3 - N
+10710 LET OV = OV + OU / 3 - N
+10720 LET OW = OW + OV / 3 - N
+10730 LET OX = OX + OW / 3 - N
+10740 LET OY = OY + OX / 3 - N
+10750 LET OZ = OZ + OY / 3 - N
+10760 LET PA = PA + OZ / 3 - N
+10770 LET PB = PB + PA / 3 - N
+10780 LET PC = PC + PB / 3 - N
+10790 LET PD = PD + PC / 3 - N
+10800 LET PE = PE + PD / 3 - N
+10810 LET PF = PF + PE / 3 - N
+10820 LET PG = PG + PF / 3 - N
+10830 LET PH = PH + PG / 3 - N
+10840 LET PI = PI + PH / 3 - N
+10850 LET PJ = PJ + PI / 3 - N
+10860 LET PK = PK + PJ / 3 - N
+10870 LET PL = PL + PK / 3 - N
+10880 LET PM = PM + PL / 3 - N
+10890 LET PN = PN + PM / 3 - N
+10900 LET PO = PO + PN / 3 - N
+10910 LET PP = PP + PO / 3 - N
+10920 LET PQ = PQ + PP / 3 - N
+10930 LET PR = PR + PQ / 3 - N
+10940 LET PS = PS + PR / 3 - N
+10950 LET PT = PT + PS / 3 - N
+10960 LET PU = PU + PT / 3 - N
+10970 LET PV = PV + PU / 3 - N
+10980 LET PW = PW + PV / 3 - N
+10990 LET PX = PX + PW / 3 - N
+11000 LET PY = PY + PX / 3 - N
+11010 LET PZ = PZ + PY / 3 - N
+11020 LET QA = QA + PZ / 3 - N
+11030 LET QB = QB + QA / 3 - N
+11040 LET QC = QC + QB / 3 - N
+11050 LET QD = QD + QC / 3 - N
+11060 LET QE = QE + QD / 3 - N
+11070 LET QF = QF + QE / 3 - N
+11080 LET QG = QG + QF / 3 - N
+11090 LET QH = QH + QG / 3 - N
+11100 LET QI = QI + QH / 3 - N
+11110 LET QJ = QJ + QI / 3 - N
+11120 LET QK = QK + QJ / 3 - N
+11130 LET QL = QL + QK / 3 - N
+11140 LET QM = QM + QL / 3 - N
+11150 LET QN = QN + QM / 3 - N
+11160 LET QO = QO + QN / 3 - N
+11170 LET QP = QP + QO / 3 - N
+11180 LET QQ = QQ + QP / 3 - N
+11190 LET QR = QR + QQ / 3 - N
+11200 LET QS = QS + QR / 3 - N
+11210 LET QT = QT + QS / 3 - N
+11220 LET QU = QU + QT / 3 - N
+11230 LET QV = QV + QU / 3 - N
+11240 LET QW = QW + QV / 3 - N
+11250 LET QX = QX + QW / 3 - N
+11260 LET QY = QY + QX / 3 - N
+11270 LET QZ = QZ + QY / 3 - N
+11280 LET RA = RA + QZ / 3 - N
+11290 LET RB = RB + RA / 3 - N
+11300 LET RC = RC + RB / 3 - N
+11310 LET RD = RD + RC / 3 - N
+11320 LET RE = RE + RD / 3 - N
+11330 LET RF = RF + RE / 3 - N
+11340 LET RG = RG + RF / 3 - N
+11350 LET RH = RH + RG / 3 - N
+11360 LET RI = RI + RH / 3 - N
+11370 LET RJ = RJ + RI / 3 - N
+11380 LET RK = RK + RJ / 3 - N
+11390 LET RL = RL + RK / 3 - N
+11400 LET RM = RM + RL / 3 - N
+11410 LET RN = RN + RM / 3 - N
+11420 LET RO = RO + RN / 3 - N
+11430 LET RP = RP + RO / 3 - N
+11440 LET RQ = RQ + RP / 3 - N
+11450 LET RR = RR + RQ / 3 - N
+11460 LET RS = RS + RR / 3 - N
+11470 LET RT = RT + RS / 3 - N
+11480 LET RU = RU + RT / 3 - N
+11490 LET RV = RV + RU / 3 - N
+11500 LET RW = RW + RV / 3 - N
+11510 LET RX = RX + RW / 3 - N
+11520 LET RY = RY + RX / 3 - N
+11530 LET RZ = RZ + RY / 3 - N
+11540 LET SA = SA + RZ / 3 - N
+11550 LET SB = SB + SA / 3 - N
+11560 LET SC = SC + SB / 3 - N
+11570 LET SD = SD + SC / 3 - N
+11580 LET SE = SE + SD / 3 - N
+11590 LET SF = SF + SE / 3 - N
+11600 LET SG = SG + SF / 3 - N
+11610 LET SH = SH + SG / 3 - N
+11620 LET SI = SI + SH / 3 - N
+11630 LET SJ = SJ + SI / 3 - N
+11640 LET SK = SK + SJ / 3 - N
+11650 LET SL = SL + SK / 3 - N
+11660 LET SM = SM + SL / 3 - N
+11670 LET SN = SN + SM / 3 - N
+11680 LET SO = SO + SN / 3 - N
+11690 LET SP = SP + SO / 3 - N
+11700 LET SQ = SQ + SP / 3 - N
+11710 LET SR = SR + SQ / 3 - N
+11720 LET SS = SS + SR / 3 - N
+11730 LET ST = ST + SS / 3 - N
+11740 LET SU = SU + ST / 3 - N
+11750 LET SV = SV + SU / 3 - N
+11760 LET SW = SW + SV / 3 - N
+11770 LET SX = SX + SW / 3 - N
+11780 LET SY = SY + SX / 3 - N
+11790 LET SZ = SZ + SY / 3 - N
+11800 LET TA = TA + SZ / 3 - N
+11810 LET TB = TB + TA / 3 - N
+11820 LET TC = TC + TB / 3 - N
+11830 LET TD = TD + TC / 3 - N
+11840 LET TE = TE + TD / 3 - N
+11850 LET TF = TF + TE / 3 - N
+11860 LET TG = TG + TF / 3 - N
+11870 LET TH = TH + TG / 3 - N
+11880 LET TI = TI + TH / 3 - N
+11890 LET TJ = TJ + TI / 3 - N
+11900 LET TK = TK + TJ / 3 - N
+11910 LET TL = TL + TK / 3 - N
+11920 LET TM = TM + TL / 3 - N
+11930 LET TN = TN + TM / 3 - N
+11940 LET TO = TO + TN / 3 - N
+11950 LET TP = TP + TO / 3 - N
+11960 LET TQ = TQ + TP / 3 - N
+11970 LET TR = TR + TQ / 3 - N
+11980 LET TS = TS + TR / 3 - N
+11990 LET TT = TT + TS / 3 - N
+12000 LET TU = TU + TT / 3 - N
+12010 LET TV = TV + TU / 3 - N
+12020 LET TW = TW + TV / 3 - N
+12030 LET TX = TX + TW / 3 - N
+12040 LET TY = TY + TX / 3 - N
+12050 LET TZ = TZ + TY / 3 - N
+12060 LET UA = UA + TZ / 3 - N
+12070 LET UB = UB + UA / 3 - N
+12080 LET UC = UC + UB / 3 - N
+12090 LET UD = UD + UC / 3 - N
+12100 LET UE = UE + UD / 3 - N
+12110 LET UF = UF + UE / 3 - N
+12120 LET UG = UG + UF / 3 - N
+12130 LET UH = UH + UG / 3 - N
+12140 LET UI = UI + UH / 3 - N
+12150 LET UJ = UJ + UI / 3 - N
+12160 LET UK = UK + UJ / 3 - N
+12170 LET UL = UL + UK / 3 - N
+12180 LET UM = UM + UL / 3 - N
+12190 LET UN = UN + UM / 3 - N
+12200 LET UO = UO + UN / 3 - N
+12210 LET UP = UP + UO / 3 - N
+12220 LET UQ = UQ + UP / 3 - N
+12230 LET UR = UR + UQ / 3 - N
+12240 LET US = US + UR / 3 - N
+12250 LET UT = UT + US / 3 - N
+12260 LET UU = UU + UT / 3 - N
+12270 LET UV = UV + UU / 3 - N
+12280 LET UW = UW + UV / 3 - N
+12290 LET UX = UX + UW / 3 - N
+12300 LET UY = UY + UX / 3 - N
+12310 LET UZ = UZ + UY / 3 - N
+12320 LET VA = VA + UZ / 3 - N
+12330 LET VB = VB + VA / 3 - N
+12340 LET VC = VC + VB / 3 - N
+12350 LET VD = VD + VC / 3 - N
+12360 LET VE = VE + VD / 3 - N
+12370 LET VF = VF + VE / 3 - N
+12380 LET VG = VG + VF / 3 - N
+12390 LET VH = VH + VG / 3 - N
+12400 LET VI = VI + VH / 3 - N
+12410 LET VJ = VJ + VI / 3 - N
+12420 LET VK = VK + VJ / 3 - N
+12430 LET VL = VL + VK / 3 - N
+12440 LET VM = VM + VL / 3 - N
+12450 LET VN = VN + VM / 3 - N
+12460 LET VO = VO + VN / 3 - N
+12470 LET VP = VP + VO / 3 - N
+12480 LET VQ = VQ + VP / 3 - N
+12490 LET VR = VR + VQ / 3 - N
+12500 LET VS = VS + VR / 3 - N
+12510 LET VT = VT + VS / 3 - N
+12520 LET VU = VU + VT / 3 - N
+12530 LET VV = VV + VU / 3 - N
+12540 LET VW = VW + VV / 3 - N
+12550 LET VX = VX + VW / 3 - N
+12560 LET VY = VY + VX / 3 - N
+12570 LET VZ = VZ + VY / 3 - N
+12580 LET WA = WA + VZ / 3 - N
+12590 LET WB = WB + WA / 3 - N
+12600 LET WC = WC + WB / 3 - N
+12610 LET WD = WD + WC / 3 - N
+12620 LET WE = WE + WD / 3 - N
+12630 LET WF = WF + WE / 3 - N
+12640 LET WG = WG + WF / 3 - N
+12650 LET WH = WH + WG / 3 - N
+12660 LET WI = WI + WH / 3 - N
+12670 LET WJ = WJ + WI / 3 - N
+12680 LET WK = WK + WJ / 3 - N
+12690 LET WL = WL + WK / 3 - N
+12700 LET WM = WM + WL / 3 - N
+12710 LET WN = WN + WM / 3 - N
+12720 LET WO = WO + WN / 3 - N
+12730 LET WP = WP + WO / 3 - N
+12740 LET WQ = WQ + WP / 3 - N
+12750 LET WR = WR + WQ / 3 - N
+12760 LET WS = WS + WR / 3 - N
+12770 LET WT = WT + WS / 3 - N
+12780 LET WU = WU + WT / 3 - N
+12790 LET WV = WV + WU / 3 - N
+12800 LET WW = WW + WV / 3 - N
+12810 LET WX = WX + WW / 3 - N
+12820 LET WY = WY + WX / 3 - N
+12830 LET WZ = WZ + WY / 3 - N
+12840 LET XA = XA + WZ / 3 - N
+12850 LET XB = XB + XA / 3 - N
+12860 LET XC = XC + XB / 3 - N
+12870 LET XD = XD + XC / 3 - N
+12880 LET XE = XE + XD / 3 - N
+12890 LET XF = XF + XE / 3 - N
+12900 LET XG = XG + XF / 3 - N
+12910 LET XH = XH + XG / 3 - N
+12920 LET XI = XI + XH / 3 - N
+12930 LET XJ = XJ + XI / 3 - N
+12940 LET XK = XK + XJ / 3 - N
+12950 LET XL = XL + XK / 3 - N
+12960 LET XM = XM + XL / 3 - N
+12970 LET XN = XN + XM / 3 - N
+12980 LET XO = XO + XN / 3 - N
+12990 LET XP = XP + XO / 3 - N
+13000 LET XQ = XQ + XP / 3 - N
+13010 LET XR = XR + XQ / 3 - N
+13020 LET XS = XS + XR / 3 - N
+13030 LET XT = XT + XS / 3 - N
+13040 LET XU = XU + XT / 3 - N
+13050 LET XV = XV + XU / 3 - N
+13060 LET XW = XW + XV / 3 - N
+13070 LET XX = XX + XW / 3 - N
+13080 LET XY = XY + XX / 3 - N
+13090 LET XZ = XZ + XY / 3 - N
+13100 LET YA = YA + XZ / 3 - N
+13110 LET YB = YB + YA / 3 - N
+13120 LET YC = YC + YB / 3 - N
+13130 LET YD = YD + YC / 3 - N
+13140 LET YE = YE + YD / 3 - N
+13150 LET YF = YF + YE / 3 - N
+13160 LET YG = YG + YF / 3 - N
+13170 LET YH = YH + YG / 3 - N
+13180 LET YI = YI + YH / 3 - N
+13190 LET YJ = YJ + YI / 3 - N
+13200 LET YK = YK + YJ / 3 - N
+13210 LET YL = YL + YK / 3 - N
+13220 LET YM = YM + YL / 3 - N
+13230 LET YN = YN + YM / 3 - N
+13240 LET YO = YO + YN / 3 - N
+13250 LET YP = YP + YO / 3 - N
+13260 LET YQ = YQ + YP / 3 - N
+13270 LET YR = YR + YQ / 3 - N
+13280 LET YS = YS + YR / 3 - N
+13290 LET YT = YT + YS / 3 - N
+13300 LET YU = YU + YT / 3 - N
+13310 LET YV = YV + YU / 3 - N
+13320 LET YW = YW + YV / 3 - N
+13330 LET YX = YX + YW / 3 - N
+13340 LET YY = YY + YX / 3 - N
+13350 LET YZ = YZ + YY / 3 - N
+13360 LET ZA = ZA + YZ / 3 - N
+13370 LET ZB = ZB + ZA / 3 - N
+13380 LET ZC = ZC + ZB / 3 - N
+13390 LET ZD = ZD + ZC / 3 - N
+13400 LET ZE = ZE + ZD / 3 - N
+13410 LET ZF = ZF + ZE / 3 - N
+13420 LET ZG = ZG + ZF / 3 - N
+13430 LET ZH = ZH + ZG / 3 - N
+13440 LET ZI = ZI + ZH / 3 - N
+13450 LET ZJ = ZJ + ZI / 3 - N
+13460 LET ZK = ZK + ZJ / 3 - N
+13470 LET ZL = ZL + ZK / 3 - N
+13480 LET ZM = ZM + ZL / 3 - N
+13490 LET ZN = ZN + ZM / 3 - N
+13500 LET ZO = ZO + ZN / 3 - N
+13510 LET ZP = ZP + ZO / 3 - N
+13520 LET ZQ = ZQ + ZP / 3 - N
+13530 LET ZR = ZR + ZQ / 3 - N
+13540 LET ZS = ZS + ZR / 3 - N
+13550 LET ZT = ZT + ZS / 3 - N
+13560 LET ZU = ZU + ZT / 3 - N
+13570 LET ZV = ZV + ZU / 3 - N
+13580 LET ZW = ZW + ZV / 3 - N
+13590 LET ZX = ZX + ZW / 3 - N
+13600 LET ZY = ZY + ZX / 3 - N
+13610 LET ZZ = ZZ + ZY / 3 - N
+13620 LET N = N + 1
+13630 IF N < 300 THEN 6860
+13640 PRINT ZZ
+13650 END
@@ -0,0 +1,7 @@
+1 REM PRINT-heavy output: one line of output per iteration
+10 LET I = 0
+20 PRINT I * 7919 - 1000000
+30 PRINT I
+40 LET I = I + 1
+50 IF I < 200000 THEN 20
+60 END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <string_view>
+#include <utility>
+
+// 单行语法树的线性分配器：节点连续存放，随 Arena 析构一次性释放。
+// 通过 make 创建的对象不会被析构，因此不能持有需要释放的资源。
+class Arena {
+ public:
+  // firstChunk 为首块的字节数，通常按源码行长度估算
+  explicit Arena(size_t firstChunk = kMinChunk) noexcept;
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  // 移动只转移块链表，已分配节点的地址不变
+  Arena(Arena&& other) noexcept;
+  Arena& operator=(Arena&& other) noexcept;
+
+  void* allocate(size_t size, size_t align);
+
+  template <typename T, typename... Args>
+  T* make(Args&&... args) {
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  // 把文本复制进 Arena，返回指向副本的视图
+  std::string_view copy(std::string_view text);
+
+  size_t bytesUsed() const noexcept { return used_; }
+
+  static constexpr size_t kMinChunk = 256;
+
+ private:
+  struct Chunk {
+    Chunk* next;
+  };
+
+  void grow(size_t size, size_t align);
+  void release() noexcept;
+
+  size_t nextChunk_;
+  Chunk* chunks_{nullptr};
+  char* cursor_{nullptr};
+  char* end_{nullptr};
+  size_t used_{0};
+};
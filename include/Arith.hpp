@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "utils/Error.hpp"
+
+// 整数四则运算内核。所有求值路径（表达式树、RPN、融合语句、字节码 VM）都经由
+// 这里计算，溢出行为由 CMake 选项 BASIC_OVERFLOW 在编译期选定：
+// - WRAP（默认）：按补码回绕，输出与参考实现一致；
+// - TRAP：结果超出 32 位时报 INTEGER OVERFLOW；
+// - WIDEN：表达式按 64 位求值，存入变量时超出 32 位才报 INTEGER OVERFLOW。
+// 溢出检测使用 __builtin_*_overflow，编译为运算指令加一条溢出跳转。
+// 错误记入 fault 而不抛出；出错后仍返回一个确定的结果，不会触发未定义行为。
+namespace arith {
+
+enum class Policy { WRAP, TRAP, WIDEN };
+
+#if defined(BASIC_OVERFLOW_TRAP)
+constexpr Policy kPolicy = Policy::TRAP;
+#elif defined(BASIC_OVERFLOW_WIDEN)
+constexpr Policy kPolicy = Policy::WIDEN;
+#else
+constexpr Policy kPolicy = Policy::WRAP;
+#endif
+
+// 表达式求值的结果类型；变量始终为 32 位
+using Word = std::conditional_t<kPolicy == Policy::WIDEN, int64_t, int>;
+
+inline Word add(Word lhs, Word rhs, Fault& fault) {
+  Word result;
+  bool overflowed = __builtin_add_overflow(lhs, rhs, &result);
+  if constexpr (kPolicy != Policy::WRAP) {
+    if (__builtin_expect(overflowed, false)) {
+      fault.raise(ErrorCode::INTEGER_OVERFLOW);
+    }
+  }
+  return result;
+}
+
+inline Word sub(Word lhs, Word rhs, Fault& fault) {
+  Word result;
+  bool overflowed = __builtin_sub_overflow(lhs, rhs, &result);
+  if constexpr (kPolicy != Policy::WRAP) {
+    if (__builtin_expect(overflowed, false)) {
+      fault.raise(ErrorCode::INTEGER_OVERFLOW);
+    }
+  }
+  return result;
+}
+
+inline Word mul(Word lhs, Word rhs, Fault& fault) {
+  Word result;
+  bool overflowed = __builtin_mul_overflow(lhs, rhs, &result);
+  if constexpr (kPolicy != Policy::WRAP) {
+    if (__builtin_expect(overflowed, false)) {
+      fault.raise(ErrorCode::INTEGER_OVERFLOW);
+    }
+  }
+  return result;
+}
+
+inline Word div(Word lhs, Word rhs, Fault& fault) {
+  if (__builtin_expect(rhs == 0, false)) {
+    fault.raise(ErrorCode::DIVIDE_BY_ZERO);
+    return 0;
+  }
+  // 最小值除以 -1 是唯一会溢出的除法，按取反处理
+  if (__builtin_expect(rhs == -1, false)) {
+    return sub(0, lhs, fault);
+  }
+  return lhs / rhs;
+}
+
+// 存入变量前收窄为 32 位
+inline int narrow(Word value, Fault& fault) {
+  if constexpr (kPolicy == Policy::WIDEN) {
+    if (__builtin_expect(value < std::numeric_limits<int>::min() ||
+                             value > std::numeric_limits<int>::max(),
+                         false)) {
+      fault.raise(ErrorCode::INTEGER_OVERFLOW);
+    }
+  }
+  return static_cast<int>(value);
+}
+
+}  // namespace arith
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Program.hpp"
+
+class Output;
+
+// 批量运行：输入文件的每一行是一组输入，对每组各 RUN 一次程序。
+// 程序只解析、编译一次，工作线程各持有一个执行视图（见 Program.hpp）共用它；
+// 每次运行有独立的变量表与输出缓冲，全部输出按输入文件中的顺序写出。
+class Batch {
+ public:
+  struct Options {
+    unsigned workers{0};  // 0 表示按硬件并发数
+    Engine engine{Engine::TREE};
+  };
+
+  // 一组输入：RUN 中的 INPUT 依次取用
+  using Tuple = std::vector<std::string_view>;
+
+  // program 在运行期间不能被修改
+  Batch(Program& program, Options options);
+
+  // 载入输入文件并运行，无法打开时抛出 BasicError
+  void run(const std::string& path, Output& out);
+  void run(const std::vector<Tuple>& tuples, Output& out);
+
+  // 每行以空白或逗号分隔各个值，空行跳过
+  static std::vector<Tuple> parse(std::string_view text);
+
+ private:
+  // 在视图上完成一次 RUN：输入用完时输出 NOT ENOUGH INPUT 并放弃本次运行，
+  // 运行时错误照常输出错误信息
+  void runOne(Program& view, Engine engine, const Tuple& tuple) const;
+
+  Program& program_;
+  Options options_;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Recorder;
+class Expression;
+class Statement;
+
+// 栈式字节码的操作码，操作数紧跟在操作码之后
+enum class OpCode : int32_t {
+  CONST,  // CONST value       压入常量
+  LOAD,   // LOAD slot         压入变量值，未定义时报错
+  ADD,
+  SUB,
+  MUL,
+  DIV,    // 除数为 0 时报 DIVIDE BY ZERO
+  STORE,  // STORE slot        弹出并赋值给变量
+  GUARD,  // GUARD target      PRINT 开始：变量未定义时输出提示并跳到 target
+  PRINT,  // 弹出并输出，同时解除 GUARD
+  INPUT,  // INPUT slot        读取整数并赋值给变量
+  JMP,    // JMP target
+  JEQ,    // JEQ target        弹出 rhs、lhs，lhs == rhs 时跳转
+  JLT,
+  JGT,
+  INDENT,  // 进入新的作用域
+  DEDENT,  // 退出当前作用域，已在全局作用域时报 SCOPE UNDERFLOW
+  FAIL,   // LINE NUMBER ERROR
+  HALT,
+  LINK    // LINK target      接上被移动过的行，与 JMP 相同
+};
+
+// 编译后的程序：跳转目标已解析为指令偏移。每行的指令连续存放且至少占
+// 两个字，修改单行时新指令追加在末尾，原位置改写为 LINK（见 Compiler::insert）
+struct Bytecode {
+  std::vector<int32_t> code;
+  // 与 code 等长：该位置是否为一行指令的开头。分段执行在这里按语句扣减
+  // 预算（见 VM.hpp），被改写为 LINK 的旧位置不再是开头
+  std::vector<uint8_t> starts;
+  int maxStack{0};
+  int32_t entry{0};  // 第一行的偏移，无程序行时为程序末尾
+
+  // 以下按执行索引的槽位（见 Recorder.hpp）：该行指令的起始偏移、跳转操作数
+  // 的位置（无跳转为 -1），以及把执行流引入该行的 LINK 操作数的位置
+  // （kFallThrough 为紧接在前一行之后顺序进入，kEntry 为程序入口）
+  std::vector<int32_t> offsets;
+  std::vector<int32_t> jumps;
+  std::vector<int32_t> fallIn;
+  // 程序末尾的 HALT 与引入它的位置，含义同上
+  int32_t end{0};
+  int32_t endFallIn{kFallThrough};
+  int32_t failStub{0};
+  // 整体编译时的指令字数
+  size_t compiledSize{0};
+  // 单行更新改写过的已有位置，供 JIT 作废覆盖它们的本机代码，由使用者清空
+  std::vector<int32_t> patched;
+
+  static constexpr int32_t kFallThrough = -1;
+  static constexpr int32_t kEntry = -2;
+
+  // 追加的指令已超过整体编译时的大小，下次 RUN 前应当整体重新编译
+  bool stale() const noexcept {
+    return code.size() > 2 * compiledSize + kSlack;
+  }
+
+ private:
+  static constexpr size_t kSlack = 4096;
+};
+
+class Compiler {
+ public:
+  Bytecode compile(const Recorder& recorder) const;
+
+  // 单行增删后就地更新：只编译被编辑的行，改写引入它的 LINK 与跳向它的
+  // 跳转，代价与程序大小无关。insert 在 Recorder 加入该行之后调用，
+  // remove 在 Recorder 删除该行之前调用
+  void insert(Bytecode& bytecode, const Recorder& recorder, int slot) const;
+  void remove(Bytecode& bytecode, const Recorder& recorder, int slot) const;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include "Loop.hpp"
+#include "Recorder.hpp"
+#include "Statement.hpp"
+
+class Output;
+
+// 程序级的控制流分析：以执行索引（见 Recorder.hpp）中的顺序后继、GOTO 与
+// IF 为边，为树遍历生成精简的执行计划：
+// - REM 不再执行，前驱直接接到其后的行；
+// - 跳向 GOTO 的边（GOTO 链、IF 跳向 GOTO、顺序进入 GOTO）穿透到最终目标；
+// - 识别计数循环（见 Loop.hpp），在循环首行的 loop 中记下编号。
+// 目标行不存在的 GOTO/IF 保留原样，执行到时照常报 LINE NUMBER ERROR。
+// 计划与执行索引按槽位一一对应，增删行时由 update 只改动受影响的槽位；
+// 基本块与可达性只在 ANALYZE 时计算。
+class Cfg {
+ public:
+  explicit Cfg(const Recorder& recorder);
+
+  Cfg(const Cfg&) = delete;
+  Cfg& operator=(const Cfg&) = delete;
+
+  // 执行索引中 line 行刚被加入或删除之后更新计划，slot 为它现在或原先
+  // 所在的槽位。只重新解析这一行、按行号的前一行、以它为目标的跳转，
+  // 以及解析时经过它们的 REM 与 GOTO，代价与程序大小无关
+  void update(const Recorder& recorder, int line, int slot);
+
+  // 执行计划：下标即执行索引中的槽位，next 与 target 已穿透 REM 与中转的
+  // GOTO。target 为 -1 表示目标行不存在；穿透后落在程序末尾的跳转保留
+  // 原来的目标，由途经的 REM/GOTO 走到末尾
+  const std::vector<ExecLine>& plan() const noexcept { return plan_; }
+  // 第一条要执行的语句，程序中没有需要执行的行时为 -1
+  int entry() const noexcept { return entry_; }
+  const CountedLoop& loop(int id) const noexcept { return loops_[id]; }
+
+  // ANALYZE：输出基本块及其后继、计数循环、被穿透的跳转、去掉的 REM 与
+  // 不可达的行
+  void print(const Recorder& recorder, Output& out) const;
+
+ private:
+  // 沿 REM 的顺序后继与 GOTO 的目标前进，返回第一条需要执行的语句所在
+  // 槽位，落到程序末尾时为 -1。只由 REM 与 GOTO 组成的环保留环上行号
+  // 最小的一行，结果与解析的先后无关
+  int resolve(const std::vector<ExecLine>& slots, int slot);
+  // 按执行索引重新生成 slot 的计划项
+  void replan(const std::vector<ExecLine>& slots, int slot);
+  // slot 所在的计数循环作废，循环末行记入 tails_ 待重新识别
+  void forgetLoop(int slot);
+  // 识别以 tail 结尾的计数循环
+  void matchLoop(int tail);
+  // 沿计划的 next 经过 LET 找到可能以 slot 为成员的循环末行，没有时为 -1
+  int loopTail(int slot) const;
+  // 槽位上的语句是否执行：有语句且 resolve 的结果是它自己
+  bool kept(int slot) const {
+    return slot >= 0 && resolved_[slot] == slot;
+  }
+
+  std::vector<ExecLine> plan_;
+  int entry_{-1};
+  // 槽位 -> resolve 的结果，kUnknown 为尚未计算
+  std::vector<int> resolved_;
+  // 槽位 -> 所在计数循环的编号，不在循环中为 -1
+  std::vector<int> loopOf_;
+  std::vector<CountedLoop> loops_;
+  std::vector<int> freeLoops_;
+  // resolve 走过的路径；update 涉及的槽位、其标记与待识别的循环末行
+  std::vector<int> path_;
+  std::vector<int> touched_;
+  std::vector<char> marked_;
+  std::vector<int> tails_;
+
+  static constexpr int kUnknown = -2;
+  static constexpr int kVisiting = -3;
+};
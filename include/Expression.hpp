@@ -1,21 +1,49 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
-class VarState;
+#include "Arith.hpp"
+#include "VarState.hpp"
+
+class Arena;
+
+// 表达式节点由 Parser 在所属行的 Arena 中创建，随 Arena 一并释放，
+// 因此节点之间不负责释放子节点。
+
+// 表达式节点种类，供编译器等后端遍历表达式树
+enum class ExprKind { CONST, VARIABLE, COMPOUND };
 
 class Expression {
  public:
   virtual ~Expression() = default;
-  virtual int evaluate(const VarState& state) const = 0;
+  // 出错时记入 fault（只保留第一个错误），返回值此时无意义
+  virtual arith::Word evaluate(const VarState& state, Fault& fault) const = 0;
+  virtual ExprKind kind() const noexcept = 0;
+
+#ifdef BASIC_EVAL_STATS
+  // evaluate 调用次数，用于比较优化前后的求值开销。--batch 的多个 worker
+  // 同时求值，只需计数，用 relaxed 累加
+  static inline std::atomic<unsigned long long> evaluations{0};
+  static void countEvaluation() noexcept {
+    evaluations.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
 };
 
 class ConstExpression : public Expression {
  public:
   explicit ConstExpression(int value);
   ~ConstExpression() = default;
-  int evaluate(const VarState& state) const override;
+  arith::Word evaluate(const VarState& state, Fault& fault) const override;
+  ExprKind kind() const noexcept override { return ExprKind::CONST; }
+
+  int value() const noexcept { return value_; }
 
  private:
   int value_;
@@ -23,22 +51,205 @@ class ConstExpression : public Expression {
 
 class VariableExpression : public Expression {
  public:
-  explicit VariableExpression(std::string name);
+  // slot 为 SymbolTable 中驻留的变量槽位
+  explicit VariableExpression(int slot);
   ~VariableExpression() = default;
-  int evaluate(const VarState& state) const override;
+  arith::Word evaluate(const VarState& state, Fault& fault) const override;
+  ExprKind kind() const noexcept override { return ExprKind::VARIABLE; }
+
+  int slot() const noexcept { return slot_; }
 
  private:
-  std::string name_;
+  int slot_;
 };
 
 class CompoundExpression : public Expression {
  public:
   CompoundExpression(Expression* left, char op, Expression* right);
-  ~CompoundExpression();
-  int evaluate(const VarState& state) const override;
+  ~CompoundExpression() = default;
+  arith::Word evaluate(const VarState& state, Fault& fault) const override;
+  ExprKind kind() const noexcept override { return ExprKind::COMPOUND; }
+
+  const Expression* left() const noexcept { return left_; }
+  const Expression* right() const noexcept { return right_; }
+  char op() const noexcept { return op_; }
 
  private:
+  friend class Optimizer;
+  friend class RpnExpression;
+
   Expression* left_;
   Expression* right_;
   char op_;
 };
+
+// 编译期特化的二元运算节点，由 makeCompound 创建：运算符与两侧操作数的种类
+// 都是模板参数，求值时不再对 op_ 分支，变量与常量操作数直接内联读取，
+// 只有任意子树仍经虚调用。节点仍是 CompoundExpression，编译器、映像与
+// 优化器照常通过 left()/op()/right() 访问。
+namespace expr {
+
+// 运算符：与 CompoundExpression::evaluate 的计算完全相同，溢出按 arith 的策略处理
+struct Add {
+  static constexpr char kSymbol = '+';
+  static arith::Word apply(arith::Word lhs, arith::Word rhs, Fault& fault) {
+    return arith::add(lhs, rhs, fault);
+  }
+};
+
+struct Sub {
+  static constexpr char kSymbol = '-';
+  static arith::Word apply(arith::Word lhs, arith::Word rhs, Fault& fault) {
+    return arith::sub(lhs, rhs, fault);
+  }
+};
+
+struct Mul {
+  static constexpr char kSymbol = '*';
+  static arith::Word apply(arith::Word lhs, arith::Word rhs, Fault& fault) {
+    return arith::mul(lhs, rhs, fault);
+  }
+};
+
+struct Div {
+  static constexpr char kSymbol = '/';
+  static arith::Word apply(arith::Word lhs, arith::Word rhs, Fault& fault) {
+    return arith::div(lhs, rhs, fault);
+  }
+};
+
+// 操作数：节点中保存 Value，求值时由 get 读出
+struct Var {
+  using Value = int;  // 变量槽位
+  static Value load(const Expression* operand) {
+    return static_cast<const VariableExpression*>(operand)->slot();
+  }
+  static arith::Word get(Value slot, const VarState& state, Fault& fault) {
+#ifdef BASIC_EVAL_STATS
+    Expression::countEvaluation();
+#endif
+    return state.getValue(slot, fault);
+  }
+};
+
+struct Const {
+  using Value = int;
+  static Value load(const Expression* operand) {
+    return static_cast<const ConstExpression*>(operand)->value();
+  }
+  static arith::Word get(Value value, const VarState&, Fault&) {
+#ifdef BASIC_EVAL_STATS
+    Expression::countEvaluation();
+#endif
+    return value;
+  }
+};
+
+// 任意子树
+struct Node {
+  using Value = const Expression*;
+  static Value load(const Expression* operand) { return operand; }
+  static arith::Word get(Value operand, const VarState& state, Fault& fault) {
+    return operand->evaluate(state, fault);
+  }
+};
+
+}  // namespace expr
+
+template <typename Op, typename L, typename R>
+class BinOp final : public CompoundExpression {
+ public:
+  BinOp(Expression* left, Expression* right)
+      : CompoundExpression(left, Op::kSymbol, right),
+        lhs_(L::load(left)),
+        rhs_(R::load(right)) {}
+
+  arith::Word evaluate(const VarState& state, Fault& fault) const override {
+#ifdef BASIC_EVAL_STATS
+    countEvaluation();
+#endif
+    // 先左后右，报错顺序与 CompoundExpression 一致
+    arith::Word lhs = L::get(lhs_, state, fault);
+    return Op::apply(lhs, R::get(rhs_, state, fault), fault);
+  }
+
+ private:
+  typename L::Value lhs_;
+  typename R::Value rhs_;
+};
+
+// 按运算符与两侧节点种类在 arena 中创建对应的 BinOp；
+// 不认识的运算符退回 CompoundExpression，求值时报 UNSUPPORTED OPERATOR
+Expression* makeCompound(Arena& arena, Expression* left, char op,
+                         Expression* right);
+
+// makeCompound 创建的最大节点，供预估 Arena 大小
+constexpr size_t kMaxCompoundSize = sizeof(BinOp<expr::Add, expr::Node, expr::Node>);
+
+// 按后序（左、右、自身）访问表达式的全部节点。用显式栈代替递归，
+// 任意深度的树都不会耗尽调用栈；栈在多次遍历之间复用
+class PostorderWalker {
+ public:
+  template <typename Visit>
+  void walk(const Expression* root, Visit&& visit) {
+    stack_.clear();
+    stack_.emplace_back(root, false);
+    while (!stack_.empty()) {
+      auto [node, expanded] = stack_.back();
+      stack_.pop_back();
+      if (!expanded && node->kind() == ExprKind::COMPOUND) {
+        auto* compound = static_cast<const CompoundExpression*>(node);
+        stack_.emplace_back(node, true);
+        stack_.emplace_back(compound->right(), false);
+        stack_.emplace_back(compound->left(), false);
+        continue;
+      }
+      visit(node);
+    }
+  }
+
+ private:
+  std::vector<std::pair<const Expression*, bool>> stack_;
+};
+
+// 很深的表达式降为后缀指令（RPN），按顺序执行并用显式的值栈求值，
+// 调用栈深度与表达式无关。所需栈深在降级时算出，不超过 kLocalStack 时
+// 直接使用调用栈上的数组。节点仍是根部的 CompoundExpression，原树保留给
+// 字节码编译、映像与优化器遍历。
+class RpnExpression final : public CompoundExpression {
+ public:
+  enum class Op : uint8_t { CONST, LOAD, ADD, SUB, MUL, DIV };
+
+  struct Instr {
+    Op op;
+    int32_t operand;  // 常量值或变量槽位
+  };
+
+  RpnExpression(CompoundExpression* root, const Instr* code, uint32_t size,
+                uint32_t maxStack);
+
+  arith::Word evaluate(const VarState& state, Fault& fault) const override;
+
+  // 深度超过 kMaxTreeDepth 的运算树降为 RPN，否则原样返回
+  static Expression* lowerIfDeep(Expression* expr, Arena& arena);
+  // 无条件降为 RPN，指令分配在 arena 中
+  static RpnExpression* lower(CompoundExpression* root, Arena& arena);
+
+  uint32_t size() const noexcept { return size_; }
+  uint32_t maxStack() const noexcept { return maxStack_; }
+
+  // 树遍历求值允许的最大深度，更深的表达式降为 RPN。实测 30 层左右起
+  // 递归求值反而慢于 RPN（见 expr_bench）
+  static constexpr int kMaxTreeDepth = 32;
+  static constexpr uint32_t kLocalStack = 64;
+
+ private:
+  // 值栈超过 kLocalStack 时使用的本线程缓冲
+  static arith::Word* scratch(uint32_t size);
+  static bool deeperThan(const Expression* expr, int limit);
+
+  const Instr* code_;
+  uint32_t size_;
+  uint32_t maxStack_;
+};
+
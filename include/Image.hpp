@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Recorder.hpp"
+#include "Statement.hpp"
+
+class SymbolTable;
+
+// 预编译程序映像（SAVEIMG / LOADIMG）：把已解析的程序行连同铺平的表达式、
+// 驻留的变量名与 LIST 使用的原文写成紧凑的二进制文件。载入时映射整个文件
+// 直接重建语句，不再经过 Lexer 与 Parser。格式见 docs/Image.md。
+class Image {
+ public:
+  // 写入执行索引中的全部程序行，变量名从 symbols 中查出；
+  // 无法写入时抛出 CANNOT WRITE FILE
+  static void save(const Recorder& recorder, const SymbolTable& symbols,
+                   const std::string& path);
+
+  // 从映像内容重建语句，顺序与写入时相同（行号升序），变量名驻留到
+  // symbols 中。fused 为真时与 Parser 一样选用融合语句。
+  // 魔数、版本或字节序不符，或内容损坏时抛出 INVALID IMAGE，不返回部分结果
+  static Recorder::Batch load(std::string_view image, SymbolTable& symbols,
+                              bool fused);
+
+  // 格式变化时递增，旧版本的映像不再被接受
+  static constexpr uint32_t kVersion = 1;
+};
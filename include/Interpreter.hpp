@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Lexer.hpp"
+#include "Loader.hpp"
+#include "Parser.hpp"
+#include "Program.hpp"
+#include "SymbolTable.hpp"
+#include "utils/Error.hpp"
+
+// 把一行输入分流到解释器指令、程序行的增删或立即执行语句。
+// 交互输入与 LOAD 载入的文件共用同一套处理逻辑。
+class Interpreter {
+ public:
+  // 程序输出写入 outputFd，默认为标准输出
+  explicit Interpreter(int outputFd = 1) : program_(outputFd) {
+    parser_.setSymbols(symbols_);
+    program_.setSymbols(symbols_);
+  }
+
+  // 处理一行输入，读到 QUIT 时返回 false
+  bool processLine(std::string_view line);
+  // 载入文件并依次处理其中的每一行，效果与逐行输入相同：文件中 RUN 的
+  // INPUT 依次读取随后的行（见 runLoaded）。文件中出现 QUIT 时返回 false
+  bool load(const std::string& path);
+
+  // 分段执行模式（服务器使用）：RUN 只调用 Program::start，由调用者驱动
+  // Program::step；INPUT 暂停等待 Program::provideInput；不支持 LOAD
+  void setResumable(bool enabled) noexcept;
+
+  Program& program() noexcept { return program_; }
+  Parser& parser() noexcept { return parser_; }
+
+  static bool isCommand(std::string_view line) noexcept;
+
+ private:
+  bool runCommand(std::string_view command);
+  // 带行号的语句增删程序行，否则立即执行并释放
+  void apply(std::optional<int> line, Statement* stmt);
+  void report(const BasicError& error);
+  // 载入的文件中的 RUN：INPUT 暂停时由 feedInput 提供输入
+  void runLoaded(Engine engine);
+  // 为等待中的 INPUT 提供一行：依次取用正在载入的文件中随后的行（嵌套
+  // LOAD 时先取内层文件），文件都已读完时改从标准输入读取；标准输入也已
+  // 结束时放弃等待（RUN 随之结束）并返回 false
+  bool feedInput();
+
+  // 本解释器自己的变量名表，解析、映像与变量表都使用它的槽位
+  SymbolTable symbols_;
+  Lexer lexer_;
+  Parser parser_;
+  Program program_;
+  int loadDepth_{0};
+  // 正在载入的各层文件：已解析的行与下一行的下标
+  struct LoadFrame {
+    std::vector<LoadedLine>* lines;
+    size_t next;
+  };
+  std::vector<LoadFrame> loading_;
+  bool resumable_{false};
+
+  // LOAD 允许嵌套的最大层数，防止文件互相载入
+  static constexpr int kMaxLoadDepth = 16;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+struct Bytecode;
+struct VMContext;
+class Output;
+class VarState;
+
+// 本机代码返回的原因，前四种与 VMExit 相同
+enum class JitExit {
+  HALT,
+  INPUT,   // 停在 INPUT 上，目标槽位见 VMContext::inputSlot
+  BUDGET,  // 本次允许的语句数已用完，停在下一行开头
+  ERROR,   // 运行时错误，见 VMContext::fault
+  MISS     // 执行到尚未翻译的位置 VMContext::ip，翻译后重新进入即可继续
+};
+
+// 翻译好的本机代码。代码按块翻译，块之间经跳转表（按字节码偏移存放
+// 本机地址）转移，执行到未翻译的位置时返回 MISS。单行更新只作废覆盖了
+// 被改写位置的块，其余代码继续使用
+class JitCode {
+ public:
+  ~JitCode();
+
+  JitCode(const JitCode&) = delete;
+  JitCode& operator=(const JitCode&) = delete;
+
+  // 从 context.ip 开始执行，与 VM::run 一样至多执行 budget 条语句，
+  // 返回时 budget 为剩余的条数；context.suspendInput 时 INPUT 暂停返回
+  JitExit run(VarState& state, Output& out, VMContext& context,
+              uint64_t& budget) const;
+
+  // 翻译从 pc 开始的一块，pc 须在语句边界上；budgeted 选择限定预算时使用
+  // 的代码。无法翻译时返回 false，调用者应改用 VM 从 pc 继续
+  bool translate(const Bytecode& bytecode, int32_t pc, bool budgeted);
+  // 翻译从入口可达、尚未翻译的全部不限预算的代码，供不能翻译的执行视图使用
+  void translateReachable(const Bytecode& bytecode);
+  // 单行更新之后调用：作废覆盖了 bytecode.patched 中任一位置的块
+  void invalidate(const Bytecode& bytecode);
+  // 作废的代码已多于仍在使用的代码，应当丢弃整个对象
+  bool wasteful() const noexcept;
+
+ private:
+  friend class Jit;
+  JitCode() = default;
+
+  // 不限预算与限定预算的代码分别翻译，前者不含预算检查（同 VM 的
+  // Budgeted）。跳转表中未翻译的位置指向 MISS 出口，owner 为所属的块
+  struct Tier {
+    std::vector<uintptr_t> table;
+    std::vector<int32_t> owner;
+  };
+  // 一块本机代码覆盖的字节码区间 [first, second) 与经跳转表转移的目标，
+  // 作废后为空
+  struct Block {
+    std::vector<std::pair<int32_t, int32_t>> words;
+    std::vector<int32_t> targets;
+    size_t bytes{0};
+    bool budgeted{false};
+  };
+  // 可执行内存按段申请，代码只追加，写入时临时改为可写
+  struct Chunk {
+    uint8_t* memory;
+    size_t size;
+    size_t used;
+  };
+
+  // 把代码复制到可执行内存，返回其地址，失败时返回空
+  uint8_t* place(const std::vector<uint8_t>& code);
+  // 跳转表扩展到字节码当前的大小
+  void grow(const Bytecode& bytecode);
+  void discard(int32_t block);
+
+  std::vector<Chunk> chunks_;
+  // 序言与 MISS 出口，位于第一段可执行内存中
+  uint8_t* entry_{nullptr};
+  uintptr_t miss_{0};
+  Tier tiers_[2];
+  std::vector<Block> blocks_;
+  size_t liveBytes_{0};
+  size_t deadBytes_{0};
+  // 代码访问的最大槽位加一，运行前据此扩展变量表
+  int slots_{0};
+};
+
+// 把字节码逐条翻译为 x86-64 机器码：操作数栈顶放在寄存器中，
+// 变量直接按槽位读写 VarState 的数组，PRINT、INPUT、作用域与错误
+// 调用回运行时。只在 x86-64 Linux 上可用
+class Jit {
+ public:
+  static bool supported() noexcept;
+
+  // 只准备序言与跳转表，代码在执行到时按块翻译。不支持的平台或申请
+  // 可执行内存失败时返回空，调用者应改用 VM 执行同一份字节码
+  std::unique_ptr<JitCode> compile(const Bytecode& bytecode) const;
+};
@@ -1,15 +1,70 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Token.hpp"
 
 class Lexer {
  public:
-  TokenStream tokenize(const std::string& line) const;
+  // 返回的 Token 直接引用 line 中的字符，line 须比 TokenStream 存活更久
+  TokenStream tokenize(std::string_view line) const;
+  TokenStream tokenize(std::string&& line) const = delete;
+
+  // 按长度与首字母分派的关键字匹配，可在编译期求值
+  static constexpr TokenType matchKeyword(std::string_view text) noexcept {
+    switch (text.size()) {
+      case 2:
+        return text == "IF" ? TokenType::IF : TokenType::UNKNOWN;
+      case 3:
+        switch (text[0]) {
+          case 'L':
+            return text == "LET" ? TokenType::LET : TokenType::UNKNOWN;
+          case 'E':
+            return text == "END" ? TokenType::END : TokenType::UNKNOWN;
+          case 'R':
+            return text == "REM"   ? TokenType::REM
+                   : text == "RUN" ? TokenType::RUN
+                                   : TokenType::UNKNOWN;
+          default:
+            return TokenType::UNKNOWN;
+        }
+      case 4:
+        switch (text[0]) {
+          case 'G':
+            return text == "GOTO" ? TokenType::GOTO : TokenType::UNKNOWN;
+          case 'T':
+            return text == "THEN" ? TokenType::THEN : TokenType::UNKNOWN;
+          case 'L':
+            return text == "LIST" ? TokenType::LIST : TokenType::UNKNOWN;
+          case 'Q':
+            return text == "QUIT" ? TokenType::QUIT : TokenType::UNKNOWN;
+          case 'H':
+            return text == "HELP" ? TokenType::HELP : TokenType::UNKNOWN;
+          default:
+            return TokenType::UNKNOWN;
+        }
+      case 5:
+        switch (text[0]) {
+          case 'P':
+            return text == "PRINT" ? TokenType::PRINT : TokenType::UNKNOWN;
+          case 'I':
+            return text == "INPUT" ? TokenType::INPUT : TokenType::UNKNOWN;
+          case 'C':
+            return text == "CLEAR" ? TokenType::CLEAR : TokenType::UNKNOWN;
+          default:
+            return TokenType::UNKNOWN;
+        }
+      case 6:
+        return text == "INDENT"   ? TokenType::INDENT
+               : text == "DEDENT" ? TokenType::DEDENT
+                                  : TokenType::UNKNOWN;
+      default:
+        return TokenType::UNKNOWN;
+    }
+  }
 
  private:
   static bool isLetterChar(char ch) noexcept;
   static bool isNumberChar(char ch) noexcept;
-  static TokenType matchKeyword(const std::string& text) noexcept;
 };
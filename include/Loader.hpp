@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Lexer.hpp"
+#include "Parser.hpp"
+#include "Statement.hpp"
+
+// 只读映射的源文件，内容在对象存活期间有效
+class MappedFile {
+ public:
+  // 打开或映射失败时抛出 CANNOT OPEN FILE
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  std::string_view contents() const noexcept { return {data_, size_}; }
+
+ private:
+  const char* data_{nullptr};
+  size_t size_{0};
+};
+
+// 批量载入时单行的预处理结果
+struct LoadedLine {
+  enum class Kind {
+    EMPTY,    // 空行，跳过
+    COMMAND,  // 解释器指令，合并时再执行
+    PARSED,   // 已解析的语句（或仅有行号的删除指令）
+    ERROR     // 词法/语法错误，合并时按位置输出
+  };
+
+  Kind kind{Kind::EMPTY};
+  // 原始行，引用源文件内容
+  std::string_view text;
+  std::optional<int> line;
+  std::unique_ptr<Statement> stmt;
+  std::string error;
+};
+
+// 把整份源码切分成行，并在多个线程上并行完成词法与语法分析。
+// 结果按文件中的顺序排列，由调用者依次合并，语义与逐行输入相同。
+class Loader {
+ public:
+  // 判断一行原始输入是否为解释器指令
+  using CommandFilter = bool (*)(std::string_view line);
+
+  // 每个线程复制一份 prototype，沿用其折叠等设置；
+  // threads 为 0 时按硬件并发数开线程
+  Loader(const Parser& prototype, CommandFilter isCommand,
+         unsigned threads = 0);
+
+  std::vector<LoadedLine> parse(std::string_view source) const;
+
+  // 按换行切分，末尾没有换行的最后一行同样计入
+  static std::vector<std::string_view> splitLines(std::string_view source);
+
+ private:
+  void parseRange(const std::vector<std::string_view>& lines,
+                  std::vector<LoadedLine>& results, size_t begin, size_t end,
+                  const Parser& parser) const;
+
+  Lexer lexer_;
+  const Parser& prototype_;
+  CommandFilter isCommand_;
+  unsigned threads_;
+
+  // 每次领取的行数，行数不足两块时不再开线程
+  static constexpr size_t kChunkLines = 512;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Recorder.hpp"
+
+class VarState;
+
+// 计数循环：执行计划（见 Cfg.hpp）中沿 next 相连的一段，最多 kMaxLength 条
+//   head:       LET ...          循环体，只有 LET
+//   ...
+//   increment:  LET I = I + c    c > 0
+//   tail:       IF I < N THEN head   N 为常量或循环体不写的变量（N > I 同样）
+// 循环体不写 I。由 Program 的循环执行器整轮执行，循环体只由下面几种
+// 累加组成时直接按闭式算出结果
+struct CountedLoop {
+  // 闭式可求的循环体语句
+  enum class Update {
+    ASSIGN,       // LET X = c
+    ADD_CONST,    // LET X = X + c
+    ADD_COUNTER,  // LET X = X + I
+  };
+  struct Step {
+    Update update;
+    int slot;
+    int value;
+  };
+
+  // 识别时沿 next 最多走的条数，编辑后重新识别的代价因此有上界
+  static constexpr int kMaxLength = 64;
+
+  int head;
+  int increment;
+  int tail;
+  // 一轮执行的语句条数，含递增与末行的 IF
+  int length;
+  int counter;
+  int step;
+  // 上界变量槽位，上界为常量时为 -1，值在 limit 中
+  int limitSlot;
+  int limit;
+  // 循环体是否读取计数器；不读时计数器只在离开循环时写回
+  bool readsCounter;
+  // 循环体能否按闭式求值，可以时各语句依次在 steps 中
+  bool closed;
+  std::vector<Step> steps;
+
+  // 识别以 plan[tail] 结尾的计数循环，不是时返回 false
+  static bool match(const std::vector<ExecLine>& plan, int tail,
+                    CountedLoop& loop);
+
+  // 闭式求值：把循环执行到结束并写回全部变量，返回执行的轮数。
+  // 不是闭式循环、变量未定义、超过 maxRounds 轮、计数器途中越界，或在
+  // TRAP/WIDEN 策略下累加会溢出时不做任何修改并返回 0，由调用者逐轮执行
+  uint64_t evaluate(VarState& state, uint64_t maxRounds) const;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+class Arena;
+class CompoundExpression;
+class Expression;
+
+// 解析后对表达式树做常量折叠与代数化简。
+// 不会改变运行期错误：除以常量 0、溢出等情形保留到执行时处理。
+class Optimizer {
+ public:
+  // 返回化简后的树，原树不被修改；新节点（包括子树变化后重建的运算节点）
+  // 分配在 arena 中，被替换的节点随 arena 释放
+  Expression* fold(Expression* expr, Arena& arena) const;
+
+ private:
+  static Expression* simplify(CompoundExpression* compound, Expression* left,
+                              Expression* right, Arena& arena);
+  static bool isConst(const Expression* expr, int value) noexcept;
+  static bool foldConstant(char op, int lhs, int rhs, int& result) noexcept;
+
+  // fold 的显式栈，在多次调用之间复用
+  mutable std::vector<std::pair<Expression*, bool>> pending_;
+  mutable std::vector<Expression*> folded_;
+};
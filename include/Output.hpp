@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 程序输出缓冲：内容先攒在缓冲区中，写满、显式 flush 或析构时
+// 才一次性写入文件描述符，避免每行一次 write 系统调用。
+class Output {
+ public:
+  enum class Mode {
+    FULL,  // 写满或显式 flush 时输出
+    LINE   // 每写完一行即输出，用于交互式终端
+  };
+
+  // 输出到终端时默认按行缓冲
+  explicit Output(int fd, size_t capacity = kDefaultCapacity);
+  ~Output();
+
+  Output(const Output&) = delete;
+  Output& operator=(const Output&) = delete;
+
+  Output& operator<<(std::string_view text);
+  Output& operator<<(char ch);
+  Output& operator<<(int value);
+  Output& operator<<(int64_t value);
+
+  void flush();
+
+  void setMode(Mode mode) noexcept { mode_ = mode; }
+  // 改为写入内存中的 sink，由调用者决定何时发送（服务器模式）
+  void captureTo(std::string* sink) noexcept;
+  Mode mode() const noexcept { return mode_; }
+
+  static constexpr size_t kDefaultCapacity = 64 * 1024;
+
+ private:
+  void append(const char* data, size_t size);
+  void writeAll(const char* data, size_t size);
+
+  int fd_;
+  std::string* sink_{nullptr};
+  Mode mode_;
+  std::vector<char> buffer_;
+  size_t size_{0};
+};
@@ -2,7 +2,12 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
+#include <vector>
 
+#include "Arena.hpp"
+#include "Optimizer.hpp"
+#include "SymbolTable.hpp"
 #include "Token.hpp"
 
 class Statement;
@@ -26,28 +31,59 @@ class ParsedLine {
 
 class Parser {
  public:
-  ParsedLine parseLine(TokenStream& tokens,
-                       const std::string& originLine) const;
+  ParsedLine parseLine(TokenStream& tokens, std::string_view originLine) const;
+
+  // 是否对解析出的表达式做常量折叠与化简，默认开启
+  void setFolding(bool enabled) noexcept;
+  // 是否为常见形状的 LET/IF 生成融合语句（见 Statement.hpp），默认开启
+  void setFusion(bool enabled) noexcept;
+  // 变量名驻留到的表，默认为 SymbolTable::global()；副本共用同一份表
+  void setSymbols(SymbolTable& symbols) noexcept;
 
  private:
   Statement* parseStatement(TokenStream& tokens,
-                            const std::string& originLine) const;
-  Statement* parseLet(TokenStream& tokens, const std::string& originLine) const;
+                            std::string_view originLine) const;
+  Statement* parseLet(TokenStream& tokens, std::string_view originLine) const;
   Statement* parsePrint(TokenStream& tokens,
-                        const std::string& originLine) const;
+                        std::string_view originLine) const;
   Statement* parseInput(TokenStream& tokens,
-                        const std::string& originLine) const;
+                        std::string_view originLine) const;
   Statement* parseGoto(TokenStream& tokens,
-                       const std::string& originLine) const;
-  Statement* parseIf(TokenStream& tokens, const std::string& originLine) const;
-  Statement* parseRem(TokenStream& tokens, const std::string& originLine) const;
-  Statement* parseEnd(TokenStream& tokens, const std::string& originLine) const;
+                       std::string_view originLine) const;
+  Statement* parseIf(TokenStream& tokens, std::string_view originLine) const;
+  Statement* parseRem(TokenStream& tokens, std::string_view originLine) const;
+  Statement* parseEnd(TokenStream& tokens, std::string_view originLine) const;
+  Statement* parseIndent(TokenStream& tokens,
+                         std::string_view originLine) const;
+  Statement* parseDedent(TokenStream& tokens,
+                         std::string_view originLine) const;
 
   Expression* parseExpression(TokenStream& tokens) const;
-  Expression* parseExpression(TokenStream& tokens, int precedence) const;
+  // 优先级爬升的迭代实现，调用栈深度与表达式长度、括号层数无关
+  Expression* parseInfix(TokenStream& tokens) const;
 
   int getPrecedence(TokenType op) const;
+  static char operatorSymbol(TokenType op);
   int parseLiteral(const Token* token) const;
 
+  // 等待右操作数的运算符，或尚未闭合的左括号（op 为 '('）
+  struct Frame {
+    Expression* left;
+    char op;
+    int precedence;  // 所在层的最低结合优先级
+  };
+
   mutable int leftParentCount{0};
+  // parseInfix 的显式栈，在多次解析之间复用
+  mutable std::vector<Frame> frames_;
+  bool fold_{true};
+  Optimizer optimizer_;
+  bool fuse_{true};
+  SymbolTable* symbols_{&SymbolTable::global()};
+  // 当前解析行的 Arena，仅在 parseLine 期间有效
+  mutable Arena* arena_{nullptr};
+
+  // 按源码长度与 token 数估算每行 Arena 的首块大小
+  static constexpr size_t kArenaBase = 64;
+  static constexpr size_t kArenaPerToken = 32;
 };
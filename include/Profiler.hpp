@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "Recorder.hpp"
+
+// 单行的剖析数据
+struct LineProfile {
+  uint64_t hits{0};
+  uint64_t ticks{0};
+  // 仅对 IF 语句有意义：条件成立（跳转）与不成立的次数
+  uint64_t taken{0};
+  uint64_t untaken{0};
+};
+
+// 按行统计执行次数与耗时。RUN 期间计数写入与执行索引一一对应的数组，
+// 结束后再按行号并入累计结果，因此热路径上没有查找。
+class Profiler {
+ public:
+  // 计时器读数：x86-64 上为 TSC 周期，其他平台为 steady_clock 纳秒
+  static uint64_t now() noexcept;
+  static const char* unit() noexcept;
+
+  // 开始一次 RUN，返回长度为 lines 的计数数组
+  LineProfile* begin(size_t lines);
+  // RUN 结束（包括出错）时把本次计数并入累计结果
+  void end(const std::vector<ExecLine>& lines);
+  void reset();
+
+  const std::map<int, LineProfile>& totals() const noexcept { return totals_; }
+
+ private:
+  std::vector<LineProfile> run_;
+  std::map<int, LineProfile> totals_;
+};
@@ -1,37 +1,201 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
 
+#include "Bytecode.hpp"
+#include "Cfg.hpp"
+#include "Jit.hpp"
+#include "Output.hpp"
+#include "Profiler.hpp"
 #include "Recorder.hpp"
+#include "VM.hpp"
 #include "VarState.hpp"
+#include "utils/Error.hpp"
 
 class Statement;
+class SymbolTable;
+
+// RUN 使用的执行引擎
+enum class Engine {
+  TREE,  // 逐行调用 Statement::execute
+  VM,    // 编译为字节码后在分发循环中执行
+  JIT    // 把字节码翻译为本机代码执行（见 Jit.hpp），不支持时退回 VM
+};
+
+// 分段执行的 RUN 返回时的状态
+enum class RunStatus {
+  FINISHED,          // 程序已结束（END、执行完最后一行或未在运行）
+  NEEDS_INPUT,       // 停在 INPUT 上，等待 provideInput
+  BUDGET_EXHAUSTED,  // 已执行满本次允许的语句数
+  ERROR              // 运行时错误，RUN 已终止，信息见 lastError
+};
 
 class Program {
  public:
-  Program();
+  // outputFd 为程序输出写入的文件描述符
+  explicit Program(int outputFd = kStdout);
+  // 执行视图（批量运行使用，见 Batch.hpp）：与 shared 共用只读的执行索引、
+  // 字节码与本机代码，变量、输出与运行状态各自独立。每次 RUN 从空的变量表
+  // 开始，INPUT 总是暂停等待 provideInput，只能使用 shared 已 prepare 的引擎；
+  // 视图存在期间 shared 不能被修改。不同线程中的视图可以同时运行
+  Program(const Program& shared, int outputFd);
 
   void addStmt(int line, Statement* stmt);
   void removeStmt(int line);
 
+  // RUN：start 后 resume 到结束，运行时错误抛出 BasicError。
+  // 分段执行模式下遇到 INPUT 时返回，之后由调用者 provideInput 并 resume。
+  // 执行期间的错误经 raise 传递，只在这里与 execute 处转换为异常
   void run();
+  void run(Engine engine);
   void list() const;
   void clear();
 
+  // SAVEIMG：把全部程序行写成预编译映像（见 Image.hpp）
+  void saveImage(const std::string& path) const;
+  // LOADIMG：载入映像中的程序行，同一行号覆盖已有的行，效果与逐行输入相同
+  void loadImage(const std::string& path);
+
+  // 立即执行一条语句，运行时错误抛出 BasicError
   void execute(Statement* stmt);
 
+  // 分段执行：start 开始一次 RUN，step 至多执行 maxStatements 条语句后返回，
+  // resume 不限条数。PC、变量与等待输入的
+  // 目标在两次调用之间保持不变；运行期间修改程序会放弃本次 RUN。
+  void start();
+  void start(Engine engine);
+  // 为引擎编译字节码并翻译入口可达的全部本机代码，返回 RUN 实际使用的
+  // 引擎：剖析时为树遍历，不支持本机代码时为 VM。执行视图之前须显式调用；
+  // start 只编译字节码，本机代码在执行到时按块翻译
+  Engine prepare(Engine engine);
+  RunStatus step(uint64_t maxStatements);
+  RunStatus resume();
+  bool running() const noexcept;
+  // 放弃暂停中的 RUN，未在运行时不做任何事
+  void stop();
+  bool awaitingInput() const noexcept;
+  // 最近一次以 ERROR 结束的 RUN 的错误信息
+  const std::string& lastError() const noexcept;
+  // 提供 INPUT 的一行输入；不是合法整数时输出 INVALID NUMBER 并重新提示，返回 false
+  bool provideInput(std::string_view line);
+  // 为真时 INPUT（RUN 中或立即执行）输出提示后暂停等待 provideInput，
+  // 默认阻塞读取标准输入
+  void setSuspendInput(bool enabled) noexcept;
+  bool suspendInput() const noexcept;
+  // INPUT 暂停：输出提示并记下目标槽位，RUN 中同时停下主循环
+  void requestInput(int slot);
+
   int getPC() const noexcept;
   void changePC(int line);
+  // GOTO/IF 跳转：目标行不存在时记下 LINE NUMBER ERROR
+  void jumpTo(int line);
+  // GOTO：跳转到 line；开启融合且目标行是 IF 时，在同一步内接着执行该 IF
+  void gotoLine(int line);
   void programEnd();
+  // 语句执行出错：记下错误并停下 RUN 的主循环，本条语句随即返回
+  void raise(const Fault& fault) noexcept;
   bool hasLine(int line) const {
-    return recorder_.hasLine(line);
+    return source().recorder_.hasLine(line);
   }
 
+  void setEngine(Engine engine) noexcept;
+  Engine engine() const noexcept;
+
+  // 融合 GOTO 与其目标 IF，LOADIMG 时生成融合语句（见 Statement.hpp），默认开启
+  void setFusion(bool enabled) noexcept;
+  bool fusion() const noexcept;
+
+  // 树遍历 RUN 按控制流分析的执行计划运行（见 Cfg.hpp），默认开启；
+  // 剖析时总是逐行执行原程序
+  void setAnalysis(bool enabled) noexcept;
+  bool analysis() const noexcept;
+  // ANALYZE：输出程序的基本块、穿透的跳转与去掉的行
+  void analyze();
+
+  // SAVEIMG/LOADIMG 查找与驻留变量名的表，须与解析程序行的 Parser 相同，
+  // 默认为 SymbolTable::global()
+  void setSymbols(SymbolTable& symbols) noexcept;
+
+  // 程序与解释器的全部标准输出都经由此缓冲
+  Output& output() noexcept;
+
+  // 逐行剖析：开启时清空已有数据（并放弃暂停中的 RUN），RUN 固定使用树遍历执行
+  void setProfiling(bool enabled);
+  bool profiling() const noexcept;
+  // 最近一次树遍历 RUN 执行的语句条数（出错时计至出错语句），VM 不计数
+  uint64_t executedStatements() const noexcept;
+  // 按耗时降序输出各行的执行次数、耗时与 IF 分支计数；timed 为 false 时
+  // 省去耗时两列并按行号输出，结果与机器和负载无关
+  void printProfile(bool timed = true) const;
+
  private:
   Recorder recorder_;
   VarState vars_;
+  mutable Output output_;
   int programCounter_;
   bool programEnd_;
+  // 本条语句是否修改了 PC（GOTO/IF 跳转）
+  bool jumped_;
+  // RUN 期间的执行索引、当前行与跳转目标槽位
+  const ExecLine* base_;
+  const ExecLine* current_;
+  int nextIndex_;
+  Engine engine_;
+  bool fusion_;
+  // 字节码缓存，程序被修改时逐行更新（见 Compiler::insert）
+  std::unique_ptr<Bytecode> bytecode_;
+  // 由 bytecode_ 按块翻译的本机代码，单行更新时只作废受影响的块，
+  // 字节码整体重新编译时丢弃
+  std::unique_ptr<JitCode> jit_;
+  // 控制流分析与执行计划，首次树遍历 RUN 时构造，此后随每次增删行更新
+  std::unique_ptr<Cfg> cfg_;
+  bool analysis_;
+  // 本次 RUN 是否在执行计划上运行：base_ 指向计划而不是执行索引
+  bool planned_;
+  // 剖析数据，PROFILE ON 之前为空
+  std::unique_ptr<Profiler> profiler_;
+  bool profiling_;
+  uint64_t executed_;
+  // 分段执行的状态：本次 RUN 的引擎、树遍历的当前行下标、VM 的暂停位置、
+  // 是否在运行、等待输入的变量槽位（-1 表示无）
+  Engine runEngine_;
+  int pc_;
+  VMContext vm_;
+  bool running_;
+  int pendingInput_;
+  bool suspendInput_;
+  // 剖析中的 RUN 的计数数组，未剖析时为空
+  LineProfile* samples_;
+  // 本条语句记下的错误，由 stepTree / execute 取走
+  Fault fault_;
+  std::string error_;
+  SymbolTable* symbols_;
+  // 执行视图共用的程序，普通的 Program 为空
+  const Program* shared_;
+
+  static constexpr int kStdout = 1;
+
+  // RUN 读取的程序行与字节码所在的 Program
+  const Program& source() const noexcept { return shared_ ? *shared_ : *this; }
+  // 已经准备好、可供执行视图使用的引擎
+  Engine prepared(Engine engine) const noexcept;
+  // 编译 RUN 所需的字节码并准备 JIT，返回实际使用的引擎
+  Engine compile(Engine engine);
 
+  template <bool Profiled>
+  RunStatus stepTree(uint64_t maxStatements);
+  // 在执行计划中从计数循环的首行 pc 开始整轮执行（见 Loop.hpp），离开循环、
+  // 预算用完或出错时返回 true 并更新 pc；一轮也执行不了时返回 false
+  bool runLoop(int& pc, uint64_t& remaining, uint64_t& executed);
+  RunStatus stepVM(uint64_t maxStatements);
+  RunStatus stepJit(uint64_t maxStatements);
+  // 在字节码缓存上执行单行更新，失败时丢弃缓存
+  template <typename Update>
+  void updateBytecode(Update&& update);
+  // 结束本次 RUN：并入剖析数据并重置运行状态，须在修改程序之前调用
+  void finishRun();
   void resetAfterRun() noexcept;
 };
@@ -2,15 +2,36 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Statement.hpp"
 
+// 执行索引中的一行。每行占用一个固定的槽位，增删其他行时不会移动，
+// 执行顺序由 next 串起
+struct ExecLine {
+  int line;
+  StmtKind kind;  // stmt->kind()，免去执行时的虚调用
+  const Statement* stmt;
+  int next;    // 按行号的下一行所在槽位，最后一行为 -1；空闲槽位中为下一个空闲槽位
+  int target;  // GOTO/IF 目标行的槽位；非跳转语句或目标行不存在时为 -1
+  int nextReferrer;  // 跳向同一目标行的下一个 GOTO/IF 所在槽位，没有时为 -1
+  int loop = -1;     // 执行计划中以本行开始的计数循环编号（见 Cfg.hpp），否则为 -1
+};
+
 class Recorder {
  public:
+  // 按行号升序排列的一批程序行
+  using Batch = std::vector<std::pair<int, std::unique_ptr<Statement>>>;
+
   ~Recorder();
 
-  void add(int line, Statement* stmt);
+  // 加入一行，同一行号覆盖已有的行；返回所在槽位，不参与执行（行号不大于 0）时为 -1
+  int add(int line, Statement* stmt);
+  // 批量加入，同一行号覆盖已有的行。行号升序时借助插入位置提示，
+  // 每行均摊常数时间
+  void addSorted(Batch&& lines);
   void remove(int line);
   const Statement* get(int line) const noexcept;
   bool hasLine(int line) const noexcept;
@@ -18,8 +39,56 @@ class Recorder {
   void printLines() const;
   int nextLine(int line) const noexcept;
 
+  // 执行索引随每次增删就地更新：只改动被编辑的行、与它相邻的行和以它为
+  // 目标的跳转，代价与程序大小无关
+  const std::vector<ExecLine>& slots() const noexcept { return slots_; }
+  // 第一行（行号最小且大于 0）的槽位，无程序行时为 -1
+  int head() const noexcept { return head_; }
+  // 行号所在槽位，不存在或不参与执行时返回 -1
+  int slotOf(int line) const;
+  // 按行号在 line 之前的最后一行所在槽位，没有（或不参与执行）时为 -1
+  int prevSlot(int line) const;
+  // 访问以 line 为目标的每个 GOTO/IF 所在槽位
+  template <typename Visit>
+  void forEachReferrer(int line, Visit&& visit) const {
+    auto it = referrers_.find(line);
+    int slot = it != referrers_.end() ? it->second : -1;
+    for (; slot != -1; slot = slots_[slot].nextReferrer) {
+      visit(slot);
+    }
+  }
+
+  // 按行号升序访问参与执行的每一行
+  template <typename Visit>
+  void forEach(Visit&& visit) const {
+    for (int slot = head_; slot != -1; slot = slots_[slot].next) {
+      visit(slots_[slot]);
+    }
+  }
+
  private:
-  // TODO.
-  // 行号与语句
-  std::map<int, Statement*> statements_;
+  using Lines = std::map<int, int>;
+
+  // 行号与所在槽位
+  Lines lines_;
+  std::vector<ExecLine> slots_;
+  int head_{-1};
+  int free_{-1};  // 空闲槽位链表
+  // 跳转目标行号 -> 跳向它的第一个槽位，其余经 nextReferrer 串起；
+  // 目标行增删时据此更新 target
+  std::unordered_map<int, int> referrers_;
+
+  // 为行号取得 map 中的位置；行号已存在时先卸下原有的语句
+  Lines::iterator place(Lines::iterator hint, int line);
+  // 把语句放入新槽位并接入执行顺序、跳转目标与以它为目标的跳转
+  void attach(Lines::iterator it, Statement* stmt);
+  // attach 的逆操作：释放语句与槽位，map 中的位置保留
+  void detach(Lines::iterator it);
+  // 按 lines_ 重新串起全部行的执行顺序、跳转目标与 referrers_
+  void relink();
+  int allocate();
+  // 把槽位挂到目标行的跳转链表上 / 从中摘下
+  void refer(int target, int slot);
+  void unrefer(int target, int slot);
+  static int targetLine(const ExecLine& entry) noexcept;
 };
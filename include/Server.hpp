@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Interpreter.hpp"
+
+// Unix 域套接字上的多会话服务器。每个连接是一个独立的会话，拥有自己的
+// Interpreter（Program、VarState），协议与标准输入逐行输入完全相同。
+// 固定数量的工作线程共享一个 epoll 实例；会话以 EPOLLONESHOT 注册，
+// 同一时刻只会被一个线程处理。INPUT 与语句预算都会让出线程。
+class Server {
+ public:
+  struct Options {
+    std::string path;
+    unsigned workers{0};  // 0 表示按硬件并发数
+    // 每个会话一次调度最多执行的语句数，用完后让出线程
+    uint64_t budget{kDefaultBudget};
+    // 会话中 RUN 默认使用的引擎
+    Engine engine{Engine::TREE};
+  };
+
+  // 创建并监听套接字，失败时抛出 BasicError
+  explicit Server(Options options);
+  ~Server();
+
+  Server(const Server&) = delete;
+  Server& operator=(const Server&) = delete;
+
+  // 启动工作线程并阻塞到 stop() 被调用
+  void serve();
+  // 可在任意线程调用
+  void stop();
+
+  static constexpr uint64_t kDefaultBudget = 100000;
+  // 未处理的输入或未发送的输出超过此值时暂停读取/执行，等待对端
+  static constexpr size_t kMaxBuffered = 1 << 20;
+
+ private:
+  struct Session {
+    Session(int socket, Engine engine);
+
+    int fd;
+    // 会话在线程间交接时的同步；EPOLLONESHOT 已保证不会有两个线程同时持有
+    std::mutex mutex;
+    // 收到的字节与已处理到的位置；待发送的输出与已发送的字节数。
+    // output 须先于 interpreter 声明：Output 析构时还会刷新到这里
+    std::string input;
+    size_t consumed{0};
+    std::string output;
+    size_t sent{0};
+    Interpreter interpreter;
+    bool eof{false};
+    bool quit{false};
+  };
+
+  void workerLoop();
+  void acceptClients();
+  // 处理一次就绪事件并重新注册；返回 false 表示应关闭会话
+  bool handle(Session* session, uint32_t events);
+  // 处理已收到的完整行并推进运行中的程序；用完预算时返回 true
+  bool drive(Session* session);
+  bool nextLine(Session* session, std::string& line);
+  void receive(Session* session);
+  void send(Session* session);
+  void rearm(Session* session, uint32_t events);
+  // 关闭连接并释放会话，之后不得再访问 session
+  void close(Session* session);
+
+  Options options_;
+  int listener_{-1};
+  int epoll_{-1};
+  // 唤醒工作线程以便退出
+  int wakeup_{-1};
+  std::vector<std::thread> workers_;
+  std::mutex sessionsMutex_;
+  // 以会话地址为键：连接断开后 fd 编号可能被新连接复用
+  std::unordered_map<Session*, std::unique_ptr<Session>> sessions_;
+};
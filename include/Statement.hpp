@@ -1,24 +1,42 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
+#include "Arena.hpp"
 #include "Expression.hpp"
+#include "Output.hpp"
 
 class Program;
 class VarState;
 
+// 语句种类，供编译器等后端识别具体语句
+enum class StmtKind { LET, PRINT, INPUT, GOTO, IF, REM, END, INDENT, DEDENT };
+
+// 语句的源码文本与表达式节点存放在本行的 Arena 中，由语句直接持有该 Arena
+// （不再单独分配），删除语句即一次性释放整行。
 class Statement {
  public:
-  explicit Statement(std::string source);
+  explicit Statement(std::string_view source);
   virtual ~Statement() = default;
 
   virtual void execute(VarState& state, Program& program) const = 0;
+  virtual StmtKind kind() const noexcept = 0;
+
+  std::string_view text() const noexcept;
 
-  const std::string& text() const noexcept;
+  // 接管本行节点所在的 Arena
+  void adoptArena(Arena&& arena) noexcept;
+  // 与其他语句共享节点所在的 Arena（LOADIMG 为整份映像只分配一次），
+  // 最后一条持有它的语句删除时释放
+  void shareArena(std::shared_ptr<const Arena> arena) noexcept;
 
  private:
-  std::string source_;
+  std::string_view source_;
+  Arena arena_;
+  std::shared_ptr<const Arena> sharedArena_;
 };
 
 // TODO: Other statement types derived from Statement, e.g., GOTOStatement,
@@ -26,27 +44,34 @@ class Statement {
 // LET变量赋值
 class LetStatement : public Statement {
  public:
-  LetStatement(std::string source, std::string var_name, Expression* expr)
-      : Statement(std::move(source)), var_name_(std::move(var_name)), assignexpr(expr) {}
+  LetStatement(std::string_view source, int var_slot, Expression* expr)
+      : Statement(source), var_slot_(var_slot), assignexpr(expr) {}
 
-  ~LetStatement() override { delete assignexpr; }
+  // fused 为真时按表达式形状选用融合语句（IncrementStatement）
+  static LetStatement* create(std::string_view source, int var_slot,
+                              Expression* expr, bool fused);
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::LET; }
+
+  int varSlot() const noexcept { return var_slot_; }
+  const Expression* expression() const noexcept { return assignexpr; }
 
  private:
-  std::string var_name_;  // 变量名
+  int var_slot_;           // 变量槽位
   Expression* assignexpr;  // 赋值表达式
 };
 
 // PRINT输出
 class PrintStatement : public Statement {
  public:
-  PrintStatement(std::string source, Expression* expr)
-      : Statement(std::move(source)), assignexpr(expr) {}
-
-  ~PrintStatement() override { delete assignexpr; }
+  PrintStatement(std::string_view source, Expression* expr)
+      : Statement(source), assignexpr(expr) {}
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::PRINT; }
+
+  const Expression* expression() const noexcept { return assignexpr; }
 
  private:
   Expression* assignexpr;  // 要输出的表达式
@@ -55,22 +80,33 @@ class PrintStatement : public Statement {
 // INPUT输入
 class InputStatement : public Statement {
  public:
-  InputStatement(std::string source, std::string var_name)
-      : Statement(std::move(source)), var_name_(std::move(var_name)) {}
+  InputStatement(std::string_view source, int var_slot)
+      : Statement(source), var_slot_(var_slot) {}
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::INPUT; }
+
+  int varSlot() const noexcept { return var_slot_; }
+
+  // 提示 " ? " 并读取一个合法整数，非法输入时重试
+  static int readValue(Output& out);
+  // 解析一行输入，不是合法整数时返回空
+  static std::optional<int> parseValue(std::string_view input);
 
  private:
-  std::string var_name_;  // 要输入的变量名
+  int var_slot_;  // 要输入的变量槽位
 };
 
 // GOTO跳转
 class GotoStatement : public Statement {
  public:
-  GotoStatement(std::string source, int target_line)
-      : Statement(std::move(source)), target_line_(target_line) {}
+  GotoStatement(std::string_view source, int target_line)
+      : Statement(source), target_line_(target_line) {}
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::GOTO; }
+
+  int targetLine() const noexcept { return target_line_; }
 
  private:
   int target_line_;  // 目标行号
@@ -79,15 +115,20 @@ class GotoStatement : public Statement {
 // IF条件跳转
 class IfStatement : public Statement {
  public:
-  IfStatement(std::string source, Expression* left, char op, Expression* right, int target_line)
-      : Statement(std::move(source)), left_(left), op_(op), right_(right), target_line_(target_line) {}
+  IfStatement(std::string_view source, Expression* left, char op, Expression* right, int target_line)
+      : Statement(source), left_(left), op_(op), right_(right), target_line_(target_line) {}
 
-  ~IfStatement() override {
-    delete left_;
-    delete right_;
-  }
+  // fused 为真时按两侧形状选用融合语句（CompareConstStatement 等）
+  static IfStatement* create(std::string_view source, Expression* left, char op,
+                             Expression* right, int target_line, bool fused);
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::IF; }
+
+  const Expression* left() const noexcept { return left_; }
+  const Expression* right() const noexcept { return right_; }
+  char op() const noexcept { return op_; }
+  int targetLine() const noexcept { return target_line_; }
 
  private:
   Expression* left_;      // 左表达式
@@ -96,18 +137,89 @@ class IfStatement : public Statement {
   int target_line_;       // 跳转行号
 };
 
+// 融合语句：常见形状的整行在一步内完成，直接读写变量槽位，不经过
+// Expression 的虚调用。它们仍是 LetStatement / IfStatement，原表达式照常保留，
+// 字节码编译、映像与 LIST 不受影响。由 create 选用，--no-fuse 关闭。
+
+// LET v = w + c（也包括 w - c 与 c + w），w 可以就是 v
+class IncrementStatement final : public LetStatement {
+ public:
+  IncrementStatement(std::string_view source, int var_slot, Expression* expr,
+                     int from_slot, int delta)
+      : LetStatement(source, var_slot, expr), from_slot_(from_slot), delta_(delta) {}
+
+  void execute(VarState& state, Program& program) const override;
+
+ private:
+  int from_slot_;  // 右侧变量槽位
+  int delta_;      // 加上的常量，减法已取反
+};
+
+// IF v op c THEN n（c op v 时交换两侧并翻转运算符）
+template <char Op>
+class CompareConstStatement final : public IfStatement {
+ public:
+  // left / op / right 为原样的条件，供字节码编译与映像使用
+  CompareConstStatement(std::string_view source, Expression* left, char op,
+                        Expression* right, int target_line, int slot, int value)
+      : IfStatement(source, left, op, right, target_line), slot_(slot), value_(value) {}
+
+  void execute(VarState& state, Program& program) const override;
+
+ private:
+  int slot_;
+  int value_;
+};
+
+// IF v op w THEN n
+template <char Op>
+class CompareVarsStatement final : public IfStatement {
+ public:
+  CompareVarsStatement(std::string_view source, Expression* left, char op,
+                       Expression* right, int target_line, int left_slot,
+                       int right_slot)
+      : IfStatement(source, left, op, right, target_line),
+        left_slot_(left_slot), right_slot_(right_slot) {}
+
+  void execute(VarState& state, Program& program) const override;
+
+ private:
+  int left_slot_;
+  int right_slot_;
+};
+
 // REM注释
 class RemStatement : public Statement {
  public:
-  explicit RemStatement(std::string source) : Statement(std::move(source)) {}
+  explicit RemStatement(std::string_view source) : Statement(source) {}
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::REM; }
 };
 
 // END终止
 class EndStatement : public Statement {
  public:
-  explicit EndStatement(std::string source) : Statement(std::move(source)) {}
+  explicit EndStatement(std::string_view source) : Statement(source) {}
+
+  void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::END; }
+};
+
+// INDENT进入新的作用域
+class IndentStatement : public Statement {
+ public:
+  explicit IndentStatement(std::string_view source) : Statement(source) {}
+
+  void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::INDENT; }
+};
+
+// DEDENT退出当前作用域
+class DedentStatement : public Statement {
+ public:
+  explicit DedentStatement(std::string_view source) : Statement(source) {}
 
   void execute(VarState& state, Program& program) const override;
+  StmtKind kind() const noexcept override { return StmtKind::DEDENT; }
 };
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// 变量名驻留表：解析时把标识符映射为稠密的整数槽位。
+// 每个 Interpreter（服务器的每个会话）持有一份，槽位号只在它的 Parser、
+// Program 与 VarState 之间通用，会话的变量表大小只取决于自己用到的变量名；
+// intern 可并发调用（LOAD 的解析线程共用同一份）。
+class SymbolTable {
+ public:
+  SymbolTable() = default;
+  SymbolTable(const SymbolTable&) = delete;
+  SymbolTable& operator=(const SymbolTable&) = delete;
+
+  // 不经过 Interpreter 直接使用 Parser/Program 时（基准、测试）的默认表
+  static SymbolTable& global();
+
+  // 返回变量名对应的槽位，首次出现时分配新槽位
+  int intern(std::string_view name);
+  const std::string& name(int slot) const;
+  int size() const noexcept;
+
+ private:
+  mutable std::mutex mutex_;
+  // deque 保证已驻留的字符串地址稳定
+  std::deque<std::string> names_;
+  // 键指向 names_ 中的字符串
+  std::unordered_map<std::string_view, int> slots_;
+  std::atomic<int> size_{0};
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 enum class TokenType {
@@ -18,6 +19,8 @@ enum class TokenType {
   CLEAR,
   QUIT,
   HELP,
+  INDENT,
+  DEDENT,
   // Basic lexical units
   IDENTIFIER,
   NUMBER,
@@ -37,9 +40,10 @@ enum class TokenType {
   UNKNOWN
 };
 
+// text 指向被分词的源码行，不持有副本；源码行须在 Token 使用期间有效
 struct Token {
   TokenType type{TokenType::UNKNOWN};
-  std::string text{};
+  std::string_view text{};
   int column{0};
 };
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Bytecode.hpp"
+#include "utils/Error.hpp"
+
+class Output;
+class VarState;
+
+// VM 返回的原因
+enum class VMExit {
+  HALT,    // 执行到 HALT，程序结束
+  INPUT,   // 停在 INPUT 上，目标槽位见 VMContext::inputSlot
+  BUDGET,  // 本次允许的语句数已用完，ip 停在下一行开头
+  ERROR    // 运行时错误，见 VMContext::fault
+};
+
+// 分段执行时跨调用保存的 VM 状态。语句之间操作数栈总是空的，
+// 因此只需记录下一条指令的偏移
+struct VMContext {
+  int ip{0};
+  int inputSlot{-1};
+  // 为真时 INPUT 暂停返回，否则阻塞读取标准输入
+  bool suspendInput{false};
+  // 以 VMExit::ERROR 返回时的错误
+  Fault fault;
+};
+
+// 基于分发循环的字节码解释器，GCC/Clang 下使用 computed goto
+class VM {
+ public:
+  // 从 context.ip 开始执行，至多执行 budget 条语句：每到一行的开头
+  // （Bytecode::starts）计一条，与树遍历的计数一致
+  VMExit run(const Bytecode& bytecode, VarState& state, Output& out,
+             VMContext& context, uint64_t budget = kUnlimited) const;
+
+  static constexpr uint64_t kUnlimited = UINT64_MAX;
+
+ private:
+  // Budgeted 为 false 时分发处不做任何检查，分发循环与不限预算时完全一致
+  template <bool Budgeted>
+  VMExit execute(const Bytecode& bytecode, VarState& state, Output& out,
+                 VMContext& context, uint64_t budget) const;
+};
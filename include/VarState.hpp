@@ -1,16 +1,86 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "utils/Error.hpp"
+
+// 变量表：以 SymbolTable 分配的槽位为下标的稠密数组，
+// 另用位图记录变量是否已定义。
+// 块作用域不单独建表：每个槽位只保存当前可见的绑定，被内层作用域遮蔽的
+// 旧绑定记入撤销日志，退出作用域时按日志逐条恢复。
 class VarState {
  public:
-  void setValue(const std::string& name, int value);
-  int getValue(const std::string& name) const;
+  // 在当前作用域中定义或赋值
+  void setValue(int slot, int value) {
+    if (slot >= static_cast<int>(values_.size())) {
+      grow(slot);
+    }
+    if (!frames_.empty()) {
+      define(slot, value);
+      return;
+    }
+    values_[slot] = value;
+    defined_[slot >> 6] |= uint64_t{1} << (slot & 63);
+  }
+
+  // 变量未定义时记下 VARIABLE NOT DEFINED 并返回 0
+  int getValue(int slot, Fault& fault) const {
+    if (__builtin_expect(!isDefined(slot), false)) {
+      fault.raise(ErrorCode::VARIABLE_NOT_DEFINED, slot);
+      return 0;
+    }
+    return values_[slot];
+  }
+
+  bool isDefined(int slot) const noexcept {
+    return slot < static_cast<int>(values_.size()) &&
+           ((defined_[slot >> 6] >> (slot & 63)) & 1);
+  }
+
+  // 不做检查的读取，调用方需保证 isDefined(slot)
+  int peek(int slot) const noexcept { return values_[slot]; }
+
+  // 供本机代码直接读写（见 Jit.hpp）：保证槽位 [0, size) 可用；
+  // 只访问这些槽位时数组不会扩容，取得的指针保持有效
+  void reserve(int size) {
+    if (size > static_cast<int>(values_.size())) {
+      grow(size - 1);
+    }
+  }
+  int* values() noexcept { return values_.data(); }
+  uint64_t* definedBits() noexcept { return defined_.data(); }
+  size_t scopeDepth() const noexcept { return frames_.size(); }
+
+  // 清空全部变量并回到全局作用域
   void clear();
 
+  void enterScope();
+  // 撤销当前作用域中的全部定义；已在全局作用域时记下 SCOPE UNDERFLOW
+  void exitScope(Fault& fault);
+  // 逐层退出，回到全局作用域
+  void resetScopes() noexcept;
+
  private:
-  std::unordered_map<std::string, int> values_;
+  // 被遮蔽的旧绑定
+  struct Shadow {
+    int slot;
+    int value;
+    uint32_t level;
+    bool defined;
+  };
+
+  void grow(int slot);
+  void define(int slot, int value);
+  void restore(size_t mark) noexcept;
+
+  std::vector<int> values_;
+  std::vector<uint64_t> defined_;
+  // 每个槽位当前绑定所在的作用域层级，全局为 0
+  std::vector<uint32_t> levels_;
+  std::vector<Shadow> undo_;
+  // 每层作用域开始时撤销日志的长度
+  std::vector<size_t> frames_;
 };
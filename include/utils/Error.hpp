@@ -1,11 +1,46 @@
 #pragma once
 
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 
+// 执行期错误码。求值与语句执行不抛异常，出错时记入 Fault，
+// 直到 REPL 边界（Program::run / Program::execute）才转换为 BasicError
+enum class ErrorCode : uint8_t {
+  NONE,
+  VARIABLE_NOT_DEFINED,
+  DIVIDE_BY_ZERO,
+  INTEGER_OVERFLOW,
+  LINE_NUMBER_ERROR,
+  SCOPE_UNDERFLOW,
+  UNSUPPORTED_OPERATOR,
+  SYNTAX_ERROR
+};
+
+// 错误码对应的提示信息，与原先抛出的 BasicError 完全一致
+const char* errorMessage(ErrorCode code) noexcept;
+
+// 执行期的错误通道：错误码与附带的数据（变量槽位、目标行号等）。
+// 只记录第一个错误，之后的运算照常返回（结果不再使用），
+// 调用方在语句边界检查一次即可
+struct Fault {
+  ErrorCode code{ErrorCode::NONE};
+  int payload{0};
+
+  void raise(ErrorCode error, int data = 0) noexcept {
+    if (code == ErrorCode::NONE) {
+      code = error;
+      payload = data;
+    }
+  }
+  explicit operator bool() const noexcept { return code != ErrorCode::NONE; }
+  const char* message() const noexcept { return errorMessage(code); }
+};
+
 class BasicError : public std::runtime_error {
  public:
   explicit BasicError(std::string&& message);
+  explicit BasicError(const Fault& fault);
 
   const std::string& message() const noexcept;
 
@@ -0,0 +1,73 @@
+#include "Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+Arena::Arena(size_t firstChunk) noexcept
+    : nextChunk_(std::max(firstChunk, kMinChunk)) {}
+
+Arena::~Arena() { release(); }
+
+Arena::Arena(Arena&& other) noexcept
+    : nextChunk_(other.nextChunk_),
+      chunks_(std::exchange(other.chunks_, nullptr)),
+      cursor_(std::exchange(other.cursor_, nullptr)),
+      end_(std::exchange(other.end_, nullptr)),
+      used_(std::exchange(other.used_, 0)) {}
+
+Arena& Arena::operator=(Arena&& other) noexcept {
+  if (this != &other) {
+    release();
+    nextChunk_ = other.nextChunk_;
+    chunks_ = std::exchange(other.chunks_, nullptr);
+    cursor_ = std::exchange(other.cursor_, nullptr);
+    end_ = std::exchange(other.end_, nullptr);
+    used_ = std::exchange(other.used_, 0);
+  }
+  return *this;
+}
+
+void Arena::release() noexcept {
+  while (chunks_ != nullptr) {
+    Chunk* next = chunks_->next;
+    ::operator delete(chunks_);
+    chunks_ = next;
+  }
+}
+
+void* Arena::allocate(size_t size, size_t align) {
+  auto aligned = [align](char* p) {
+    auto addr = reinterpret_cast<uintptr_t>(p);
+    return reinterpret_cast<char*>((addr + align - 1) & ~(uintptr_t{align} - 1));
+  };
+  char* p = aligned(cursor_);
+  if (cursor_ == nullptr || p + size > end_) {
+    grow(size, align);
+    p = aligned(cursor_);
+  }
+  cursor_ = p + size;
+  used_ += size;
+  return p;
+}
+
+std::string_view Arena::copy(std::string_view text) {
+  if (text.empty()) {
+    return {};
+  }
+  auto* dst = static_cast<char*>(allocate(text.size(), 1));
+  std::memcpy(dst, text.data(), text.size());
+  return {dst, text.size()};
+}
+
+// 申请新块，块大小逐次翻倍；超大请求单独成块
+void Arena::grow(size_t size, size_t align) {
+  size_t bytes = std::max(nextChunk_, sizeof(Chunk) + size + align);
+  auto* chunk = static_cast<Chunk*>(::operator new(bytes));
+  chunk->next = chunks_;
+  chunks_ = chunk;
+  cursor_ = reinterpret_cast<char*>(chunk + 1);
+  end_ = reinterpret_cast<char*>(chunk) + bytes;
+  nextChunk_ = bytes * 2;
+}
@@ -1,118 +1,100 @@
-#include <cctype>
+#include <cstdlib>
 #include <iostream>
-#include <memory>
 #include <string>
+#include <vector>
 
-#include "Lexer.hpp"
-#include "Parser.hpp"
-#include "Program.hpp"
-#include "Token.hpp"
+#include "Batch.hpp"
+#include "Expression.hpp"
+#include "Interpreter.hpp"
+#include "Server.hpp"
 #include "utils/Error.hpp"
 
-// 辅助函数：去除前后的空格
-static std::string trim(const std::string& s) {
-  auto start = s.begin();
-  while (start != s.end() && std::isspace(static_cast<unsigned char>(*start))) {
-    start++;
-  }
-
-  auto end = s.end();
-  do {
-    end--;
-  } while (std::distance(start, end) > 0 &&
-           std::isspace(static_cast<unsigned char>(*end)));
-
-  return std::string(start, end + 1);
-}
-
-// 打印帮助信息
-static void printHelp() {
-  std::cout << "Supported commands:\n";
-  std::cout << "  General statements (with line number):\n";
-  std::cout << "    REM <comment> - Comment line (ignored)\n";
-  std::cout
-      << "    LET <var> = <expr> - Assign expression result to variable\n";
-  std::cout << "    PRINT <expr> - Evaluate expression and print result\n";
-  std::cout
-      << "    INPUT <var> - Prompt with '?', read integer into variable\n";
-  std::cout << "    END - Terminate program execution\n";
-  std::cout << "    GOTO <line> - Jump to specified line number\n";
-  std::cout << "    IF <expr1> <op> <expr2> THEN <line> - Conditional jump "
-               "(op: =, <, >)\n";
-  std::cout
-      << "  Immediate execution (without line number): LET, PRINT, INPUT\n";
-  std::cout << "  Interpreter commands:\n";
-  std::cout << "    RUN - Execute program from lowest line number\n";
-  std::cout << "    LIST - Display all program lines in order\n";
-  std::cout << "    CLEAR - Remove all program lines\n";
-  std::cout << "    QUIT - Exit the interpreter\n";
-  std::cout << "    HELP - Show this help message\n";
-}
+int main(int argc, char** argv) {
+  Interpreter interpreter;
+  Program& program = interpreter.program();
+  std::vector<std::string> files;
+  Server::Options server;
+  std::string batchPath;
 
-int main() {
-  Lexer lexer;
-  Parser parser;
-  Program program;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--server" && hasValue) {
+      server.path = argv[++i];
+    } else if (arg == "--batch" && hasValue) {
+      batchPath = argv[++i];
+    } else if (arg == "--workers" && hasValue) {
+      server.workers = std::strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--budget" && hasValue) {
+      server.budget = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--vm") {
+      program.setEngine(Engine::VM);
+      server.engine = Engine::VM;
+    } else if (arg == "--jit") {
+      // 不支持的平台上与 --vm 相同
+      program.setEngine(Engine::JIT);
+      server.engine = Engine::JIT;
+    } else if (arg == "--no-fold") {
+      interpreter.parser().setFolding(false);
+    } else if (arg == "--no-fuse") {
+      // 关闭融合语句，用于与普通语句树做差分测试
+      interpreter.parser().setFusion(false);
+      program.setFusion(false);
+    } else if (arg == "--no-analysis") {
+      // 树遍历逐行执行原程序，用于与执行计划做差分测试
+      program.setAnalysis(false);
+    } else if (arg == "--line-buffered") {
+      program.output().setMode(Output::Mode::LINE);
+    } else if (arg.compare(0, 2, "--") != 0) {
+      // 其余参数视为源文件，读取标准输入前依次载入
+      files.push_back(arg);
+    }
+  }
 
-  std::string line;
-  while (std::getline(std::cin, line)) {
-    std::string trimmedLine = trim(line);
-    if (trimmedLine.empty()) {
-      continue;
+  if (!server.path.empty()) {
+    // 服务器模式：每个连接一个独立的会话，协议与标准输入相同
+    try {
+      Server(std::move(server)).serve();
+    } catch (const BasicError& e) {
+      std::cerr << e.message() << '\n';
+      return 1;
     }
+    return 0;
+  }
 
-    // 优先处理解释器指令
-    if (trimmedLine == "QUIT") {
+  bool proceed = true;
+  for (const std::string& file : files) {
+    try {
+      proceed = interpreter.load(file);
+    } catch (const BasicError& e) {
+      program.output() << e.message() << '\n';
+      program.output().flush();
+    }
+    if (!proceed) {
       break;
-    } else if (trimmedLine == "RUN") {
-      try {
-        program.run();
-      } catch (const BasicError& e) {
-        std::cout << e.message() << std::endl;
-      }
-      continue;
-    } else if (trimmedLine == "LIST") {
-      program.list();
-      continue;
-    } else if (trimmedLine == "CLEAR") {
-      program.clear();
-      continue;
-    } else if (trimmedLine == "HELP") {
-      printHelp();
-      continue;
     }
-    // 处理其他语句
-    try {
-      TokenStream tokens = lexer.tokenize(line);
-      if (tokens.empty()) {
-        continue;
-      }
-      ParsedLine parsedLine = parser.parseLine(tokens, line);
-      auto lineNumber = parsedLine.getLine();
-      Statement* stmt = parsedLine.fetchStatement();
+  }
 
-      if (lineNumber.has_value()) {
-        // 带行号的语句：若语句为空，删除；否则添加更新
-        if (stmt == nullptr) {
-          program.removeStmt(lineNumber.value());
-        } else {
-          program.addStmt(lineNumber.value(), stmt);
-        }
-      } else {
-        if (stmt != nullptr) {
-          try {
-            program.execute(stmt);
-          } catch (const BasicError& e) {
-            delete stmt;
-            throw e;
-          }
-          delete stmt;
-          stmt = nullptr;
-        }
-      }
+  if (proceed && !batchPath.empty()) {
+    // 批量模式：载入的程序对输入文件的每一行各运行一次，不读取标准输入
+    Batch::Options options;
+    options.workers = server.workers;
+    options.engine = program.engine();
+    try {
+      Batch(program, options).run(batchPath, program.output());
     } catch (const BasicError& e) {
-      std::cout << e.message() << "\n";
+      program.output() << e.message() << '\n';
     }
+    program.output().flush();
+    return 0;
   }
+
+  std::string line;
+  while (proceed && std::getline(std::cin, line)) {
+    proceed = interpreter.processLine(line);
+  }
+#ifdef BASIC_EVAL_STATS
+  std::cerr << "evaluations: " << Expression::evaluations.load() << "\n";
+#endif
   return 0;
-}
\ No newline at end of file
+}
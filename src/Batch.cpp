@@ -0,0 +1,115 @@
+#include "Batch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "Loader.hpp"
+#include "Output.hpp"
+
+Batch::Batch(Program& program, Options options)
+    : program_(program), options_(options) {
+  if (options_.workers == 0) {
+    options_.workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+void Batch::run(const std::string& path, Output& out) {
+  MappedFile file(path);
+  run(parse(file.contents()), out);
+}
+
+void Batch::run(const std::vector<Tuple>& tuples, Output& out) {
+  // 视图只读共用的程序，编译须在开线程之前完成；编译错误在这里抛出
+  Engine engine = program_.prepare(options_.engine);
+
+  std::vector<std::string> outputs(tuples.size());
+  std::vector<char> done(tuples.size(), 0);
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::atomic<size_t> next{0};
+
+  // 各线程领取下一组输入，输出写入各自下标
+  auto work = [&]() {
+    // text 须先于 view 声明：Output 析构时还会刷新到这里
+    std::string text;
+    Program view(program_, -1);  // 输出全部捕获，不写文件描述符
+    view.output().captureTo(&text);
+    for (size_t i = next++; i < tuples.size(); i = next++) {
+      text.clear();
+      runOne(view, engine, tuples[i]);
+      view.output().flush();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        outputs[i] = std::move(text);
+        done[i] = 1;
+      }
+      ready.notify_all();
+    }
+  };
+  size_t workers = std::min<size_t>(options_.workers, tuples.size());
+  std::vector<std::thread> threads;
+  threads.reserve(workers);
+  for (size_t i = 0; i < workers; ++i) {
+    threads.emplace_back(work);
+  }
+
+  // 按输入顺序写出，已完成的后续结果先留在内存中
+  for (size_t i = 0; i < tuples.size(); ++i) {
+    std::string text;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ready.wait(lock, [&] { return done[i] != 0; });
+      text = std::move(outputs[i]);
+    }
+    out << text;
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+void Batch::runOne(Program& view, Engine engine, const Tuple& tuple) const {
+  view.start(engine);
+  size_t used = 0;
+  RunStatus status = view.resume();
+  while (status == RunStatus::NEEDS_INPUT) {
+    if (used == tuple.size()) {
+      view.output() << "NOT ENOUGH INPUT\n";
+      return;
+    }
+    // 不合法的值与逐行输入时一样输出 INVALID NUMBER，由下一个值重试
+    view.provideInput(tuple[used++]);
+    status = view.resume();
+  }
+  if (status == RunStatus::ERROR) {
+    view.output() << view.lastError() << '\n';
+  }
+}
+
+std::vector<Batch::Tuple> Batch::parse(std::string_view text) {
+  std::vector<Tuple> tuples;
+  for (std::string_view line : Loader::splitLines(text)) {
+    Tuple tuple;
+    size_t start = 0;
+    while (true) {
+      start = line.find_first_not_of(" \t\r,", start);
+      if (start == std::string_view::npos) {
+        break;
+      }
+      size_t end = line.find_first_of(" \t\r,", start);
+      if (end == std::string_view::npos) {
+        end = line.size();
+      }
+      tuple.push_back(line.substr(start, end - start));
+      start = end;
+    }
+    if (!tuple.empty()) {
+      tuples.push_back(std::move(tuple));
+    }
+  }
+  return tuples;
+}
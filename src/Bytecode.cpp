@@ -0,0 +1,321 @@
+#include "Bytecode.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Expression.hpp"
+#include "Recorder.hpp"
+#include "Statement.hpp"
+#include "utils/Error.hpp"
+
+namespace {
+
+// 编译的状态：指令缓冲与待回填的跳转。整体编译与单行更新共用，
+// 单行更新时指令追加在已有的指令之后
+class Emitter {
+ public:
+  Emitter(Bytecode& out, const Recorder& recorder)
+      : out_(out), recorder_(recorder), slots_(recorder.slots()) {
+    size_t size = slots_.size();
+    out_.offsets.resize(size, -1);
+    out_.jumps.resize(size, -1);
+    out_.fallIn.resize(size, Bytecode::kFallThrough);
+  }
+
+  void emit(OpCode op) { word(static_cast<int32_t>(op)); }
+
+  void emit(OpCode op, int32_t operand) {
+    emit(op);
+    word(operand);
+  }
+
+  // 发出跳转，目标行在 link 时回填
+  void emitJump(OpCode op, int target) {
+    emit(op, -1);
+    fixups_.emplace_back(offset() - 1, target);
+  }
+
+  int offset() const { return static_cast<int>(out_.code.size()); }
+
+  // 表达式按后序发出，恰好是栈机的求值顺序
+  void expression(const Expression* expr) {
+    walker_.walk(expr, [this](const Expression* node) {
+      switch (node->kind()) {
+        case ExprKind::CONST:
+          emit(OpCode::CONST,
+               static_cast<const ConstExpression*>(node)->value());
+          push();
+          break;
+        case ExprKind::VARIABLE:
+          emit(OpCode::LOAD,
+               static_cast<const VariableExpression*>(node)->slot());
+          push();
+          break;
+        case ExprKind::COMPOUND:
+          emit(arithmetic(static_cast<const CompoundExpression*>(node)->op()));
+          --depth_;
+          break;
+      }
+    });
+  }
+
+  // 整体编译中的一行：紧接前一行之后，顺序执行进入下一行
+  void line(int slot) {
+    int start = offset();
+    out_.offsets[slot] = start;
+    statement(slot);
+    // 至少占两个字，以便移动这一行时在原位置写下 LINK
+    if (offset() - start < kMinLine) {
+      emit(OpCode::LINK, offset() + 2);
+    }
+    out_.starts[start] = 1;
+  }
+
+  // 单行更新：把一行追加在末尾，末尾用 LINK 接回下一行
+  void relocatedLine(int slot) {
+    int start = offset();
+    out_.offsets[slot] = start;
+    statement(slot);
+    int next = slots_[slot].next;
+    emit(OpCode::LINK, startOf(next));
+    fallInOf(next) = offset() - 1;
+    out_.starts[start] = 1;
+  }
+
+  // 程序末尾：两个字的 HALT，同样可以被改写为 LINK
+  void end() {
+    out_.end = offset();
+    emit(OpCode::HALT);
+    emit(OpCode::HALT);
+  }
+
+  // slot 为 -1 时表示程序末尾
+  int32_t startOf(int slot) const {
+    return slot < 0 ? out_.end : out_.offsets[slot];
+  }
+
+  int32_t& fallInOf(int slot) {
+    return slot < 0 ? out_.endFallIn : out_.fallIn[slot];
+  }
+
+  // 改写引入某一行的 LINK 操作数（或程序入口）
+  void setLink(int32_t link, int32_t target) {
+    if (link == Bytecode::kEntry) {
+      out_.entry = target;
+    } else {
+      rewrite(link, target);
+    }
+  }
+
+  // 返回引入 slot 的 LINK 操作数。若 slot 是紧接前一行顺序进入的，先把它
+  // 移到末尾，并在原位置写下 LINK，之后改写该 LINK 即可改变执行流
+  int32_t linkInto(int slot) {
+    int32_t in = fallInOf(slot);
+    if (in != Bytecode::kFallThrough) {
+      return in;
+    }
+    int32_t old = startOf(slot);
+    if (slot < 0) {
+      end();
+    } else {
+      relocatedLine(slot);
+      link();
+      retarget(slots_[slot].line, startOf(slot));
+    }
+    overwriteWithLink(old, startOf(slot));
+    fallInOf(slot) = old + 1;
+    return old + 1;
+  }
+
+  // 把 at 处一行（或程序末尾）的前两个字改写为 LINK target
+  void overwriteWithLink(int32_t at, int32_t target) {
+    rewrite(at, static_cast<int32_t>(OpCode::LINK));
+    rewrite(at + 1, target);
+    out_.starts[at] = 0;
+  }
+
+  // 跳向 line 的 GOTO/IF 改为跳向 target
+  void retarget(int line, int32_t target) {
+    recorder_.forEachReferrer(line, [&](int from) {
+      int32_t operand = out_.jumps[from];
+      if (operand >= 0) {
+        rewrite(operand, target);
+      }
+    });
+  }
+
+  void statement(int slot) {
+    const ExecLine& line = slots_[slot];
+    const Statement* stmt = line.stmt;
+    switch (stmt->kind()) {
+      case StmtKind::LET: {
+        auto* let = static_cast<const LetStatement*>(stmt);
+        expression(let->expression());
+        emit(OpCode::STORE, let->varSlot());
+        --depth_;
+        break;
+      }
+      case StmtKind::PRINT: {
+        auto* print = static_cast<const PrintStatement*>(stmt);
+        emit(OpCode::GUARD, -1);
+        int guard = offset() - 1;
+        expression(print->expression());
+        emit(OpCode::PRINT);
+        --depth_;
+        out_.code[guard] = offset();
+        break;
+      }
+      case StmtKind::INPUT:
+        emit(OpCode::INPUT,
+             static_cast<const InputStatement*>(stmt)->varSlot());
+        break;
+      case StmtKind::GOTO:
+        emitJump(OpCode::JMP, line.target);
+        out_.jumps[slot] = offset() - 1;
+        break;
+      case StmtKind::IF: {
+        auto* branch = static_cast<const IfStatement*>(stmt);
+        expression(branch->left());
+        expression(branch->right());
+        emitJump(comparison(branch->op()), line.target);
+        out_.jumps[slot] = offset() - 1;
+        depth_ -= 2;
+        break;
+      }
+      case StmtKind::REM:
+        break;
+      case StmtKind::END:
+        emit(OpCode::HALT);
+        break;
+      case StmtKind::INDENT:
+        emit(OpCode::INDENT);
+        break;
+      case StmtKind::DEDENT:
+        emit(OpCode::DEDENT);
+        break;
+    }
+  }
+
+  // 共享的 FAIL 指令，目标行不存在的跳转都跳向这里
+  void failStub() {
+    out_.failStub = offset();
+    emit(OpCode::FAIL);
+  }
+
+  // 回填跳转，目标行须已编译
+  void link() {
+    for (auto [operand, target] : fixups_) {
+      out_.code[operand] = target >= 0 ? out_.offsets[target] : out_.failStub;
+    }
+    fixups_.clear();
+  }
+
+ private:
+  void word(int32_t value) {
+    out_.code.push_back(value);
+    out_.starts.push_back(0);
+  }
+
+  // 改写已发出的指令字并记下位置
+  void rewrite(int32_t at, int32_t value) {
+    out_.code[at] = value;
+    out_.patched.push_back(at);
+  }
+
+  void push() {
+    ++depth_;
+    out_.maxStack = std::max(out_.maxStack, depth_);
+  }
+
+  static OpCode arithmetic(char op) {
+    switch (op) {
+      case '+':
+        return OpCode::ADD;
+      case '-':
+        return OpCode::SUB;
+      case '*':
+        return OpCode::MUL;
+      case '/':
+        return OpCode::DIV;
+      default:
+        throw BasicError("UNSUPPORTED OPERATOR");
+    }
+  }
+
+  static OpCode comparison(char op) {
+    switch (op) {
+      case '=':
+        return OpCode::JEQ;
+      case '<':
+        return OpCode::JLT;
+      case '>':
+        return OpCode::JGT;
+      default:
+        throw BasicError("SYNTAX ERROR");
+    }
+  }
+
+  static constexpr int kMinLine = 2;
+
+  Bytecode& out_;
+  const Recorder& recorder_;
+  const std::vector<ExecLine>& slots_;
+  // 跳转操作数的位置与目标槽位
+  std::vector<std::pair<int, int>> fixups_;
+  PostorderWalker walker_;
+  int depth_{0};
+};
+
+}  // namespace
+
+Bytecode Compiler::compile(const Recorder& recorder) const {
+  Bytecode result;
+  Emitter emitter(result, recorder);
+  int head = recorder.head();
+  if (head >= 0) {
+    result.fallIn[head] = Bytecode::kEntry;
+  } else {
+    result.endFallIn = Bytecode::kEntry;
+  }
+  for (int slot = head; slot != -1; slot = recorder.slots()[slot].next) {
+    emitter.line(slot);
+  }
+  // 执行完最后一行后自然结束
+  emitter.end();
+  result.entry = head >= 0 ? result.offsets[head] : result.end;
+  emitter.failStub();
+  emitter.link();
+  result.compiledSize = result.code.size();
+  return result;
+}
+
+void Compiler::insert(Bytecode& bytecode, const Recorder& recorder,
+                      int slot) const {
+  Emitter emitter(bytecode, recorder);
+  // 原本进入下一行的执行流改为进入新的一行，新的一行再接回下一行
+  int32_t link = emitter.linkInto(recorder.slots()[slot].next);
+  emitter.relocatedLine(slot);
+  emitter.link();
+  emitter.setLink(link, bytecode.offsets[slot]);
+  bytecode.fallIn[slot] = link;
+  emitter.retarget(recorder.slots()[slot].line, bytecode.offsets[slot]);
+}
+
+void Compiler::remove(Bytecode& bytecode, const Recorder& recorder,
+                      int slot) const {
+  Emitter emitter(bytecode, recorder);
+  // 进入这一行的执行流直接进入下一行；顺序进入时在这一行的原位置写下 LINK
+  int32_t link = bytecode.fallIn[slot];
+  int next = recorder.slots()[slot].next;
+  if (link == Bytecode::kFallThrough) {
+    int32_t old = bytecode.offsets[slot];
+    emitter.overwriteWithLink(old, emitter.startOf(next));
+    link = old + 1;
+  }
+  emitter.setLink(link, emitter.startOf(next));
+  emitter.fallInOf(next) = link;
+  emitter.retarget(recorder.slots()[slot].line, bytecode.failStub);
+  bytecode.offsets[slot] = -1;
+  bytecode.jumps[slot] = -1;
+  bytecode.fallIn[slot] = Bytecode::kFallThrough;
+}
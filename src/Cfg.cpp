@@ -0,0 +1,405 @@
+#include "Cfg.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Output.hpp"
+
+namespace {
+
+// GOTO/IF 语句中写的目标行号
+int jumpLine(const ExecLine& entry) {
+  if (entry.kind == StmtKind::GOTO) {
+    return static_cast<const GotoStatement*>(entry.stmt)->targetLine();
+  }
+  return static_cast<const IfStatement*>(entry.stmt)->targetLine();
+}
+
+bool isJump(StmtKind kind) {
+  return kind == StmtKind::GOTO || kind == StmtKind::IF;
+}
+
+// 执行时只是中转的语句：REM 与目标行存在的 GOTO
+bool passes(const ExecLine& entry) {
+  return entry.kind == StmtKind::REM ||
+         (entry.kind == StmtKind::GOTO && entry.target >= 0);
+}
+
+// 穿透的边：from 行原本进入 via 行，现在直接进入 to 行（-1 为程序末尾）
+struct Thread {
+  int from;
+  int via;
+  int to;
+};
+
+}  // namespace
+
+Cfg::Cfg(const Recorder& recorder) {
+  const std::vector<ExecLine>& slots = recorder.slots();
+  plan_.resize(slots.size());
+  resolved_.assign(slots.size(), kUnknown);
+  loopOf_.assign(slots.size(), -1);
+  marked_.assign(slots.size(), 0);
+  auto slotOf = [&](const ExecLine& entry) {
+    return static_cast<int>(&entry - slots.data());
+  };
+  recorder.forEach(
+      [&](const ExecLine& entry) { resolve(slots, slotOf(entry)); });
+  recorder.forEach(
+      [&](const ExecLine& entry) { replan(slots, slotOf(entry)); });
+  recorder.forEach([&](const ExecLine& entry) { matchLoop(slotOf(entry)); });
+  entry_ = resolve(slots, recorder.head());
+}
+
+void Cfg::update(const Recorder& recorder, int line, int slot) {
+  const std::vector<ExecLine>& slots = recorder.slots();
+  if (plan_.size() < slots.size()) {
+    plan_.resize(slots.size());
+    resolved_.resize(slots.size(), kUnknown);
+    loopOf_.resize(slots.size(), -1);
+    marked_.resize(slots.size(), 0);
+  }
+  touched_.clear();
+  auto touch = [&](int from) {
+    if (from >= 0 && !marked_[from]) {
+      marked_[from] = 1;
+      touched_.push_back(from);
+    }
+  };
+  // 边有变化的行：被编辑的行、按行号的前一行与以它为目标的跳转
+  touch(slot);
+  touch(recorder.prevSlot(line));
+  recorder.forEachReferrer(line, touch);
+  // 解析结果可能经过它们的 REM 与 GOTO 同样要重新解析，沿顺序前驱与跳向
+  // 它的跳转向前扩散；其余的前驱只需重新生成计划项
+  size_t edited = touched_.size();
+  for (size_t i = 0; i < touched_.size(); ++i) {
+    const ExecLine& entry = slots[touched_[i]];
+    if (entry.stmt != nullptr && (i < edited || passes(entry))) {
+      touch(recorder.prevSlot(entry.line));
+      recorder.forEachReferrer(entry.line, touch);
+    }
+  }
+
+  // 先在旧的计划上拆掉涉及的循环，再重新解析、生成计划项并识别循环
+  tails_.clear();
+  for (int from : touched_) {
+    forgetLoop(from);
+    resolved_[from] = kUnknown;
+    marked_[from] = 0;
+  }
+  for (int from : touched_) {
+    if (slots[from].stmt != nullptr) {
+      resolve(slots, from);
+    }
+  }
+  for (int from : touched_) {
+    replan(slots, from);
+  }
+  entry_ = resolve(slots, recorder.head());
+  for (int from : touched_) {
+    int tail = loopTail(from);
+    if (tail >= 0) {
+      tails_.push_back(tail);
+    }
+  }
+  for (int tail : tails_) {
+    matchLoop(tail);
+  }
+}
+
+int Cfg::resolve(const std::vector<ExecLine>& slots, int slot) {
+  path_.clear();
+  int result = -1;
+  for (int current = slot; current >= 0;) {
+    if (resolved_[current] >= -1) {
+      result = resolved_[current];
+      break;
+    }
+    if (resolved_[current] == kVisiting) {
+      // 回到了本次走过的行：环上行号最小的一行保留执行
+      result = current;
+      for (auto it = std::find(path_.begin(), path_.end(), current);
+           it != path_.end(); ++it) {
+        if (slots[*it].line < slots[result].line) {
+          result = *it;
+        }
+      }
+      break;
+    }
+    const ExecLine& entry = slots[current];
+    if (!passes(entry)) {
+      result = current;
+      resolved_[current] = current;
+      break;
+    }
+    resolved_[current] = kVisiting;
+    path_.push_back(current);
+    current = entry.kind == StmtKind::REM ? entry.next : entry.target;
+  }
+  for (int from : path_) {
+    resolved_[from] = result;
+  }
+  return result;
+}
+
+void Cfg::replan(const std::vector<ExecLine>& slots, int slot) {
+  const ExecLine& entry = slots[slot];
+  ExecLine& planned = plan_[slot];
+  planned = entry;
+  planned.nextReferrer = -1;
+  planned.loop = -1;
+  if (entry.stmt == nullptr || entry.line <= 0) {
+    return;  // 空闲槽位与不参与执行的行
+  }
+  // END 与 GOTO 不会顺序进入下一行
+  planned.next = entry.kind == StmtKind::END || entry.kind == StmtKind::GOTO
+                     ? -1
+                     : resolve(slots, entry.next);
+  if (isJump(entry.kind) && entry.target >= 0) {
+    int to = resolve(slots, entry.target);
+    planned.target = to >= 0 ? to : entry.target;
+  }
+}
+
+void Cfg::forgetLoop(int slot) {
+  int id = loopOf_[slot];
+  if (id < 0) {
+    return;
+  }
+  const CountedLoop& loop = loops_[id];
+  for (int member = loop.head;; member = plan_[member].next) {
+    loopOf_[member] = -1;
+    if (member == loop.tail) {
+      break;
+    }
+  }
+  plan_[loop.head].loop = -1;
+  tails_.push_back(loop.tail);
+  freeLoops_.push_back(id);
+}
+
+void Cfg::matchLoop(int tail) {
+  CountedLoop loop;
+  if (loopOf_[tail] >= 0 || !CountedLoop::match(plan_, tail, loop)) {
+    return;
+  }
+  int id = static_cast<int>(loops_.size());
+  if (freeLoops_.empty()) {
+    loops_.push_back(std::move(loop));
+  } else {
+    id = freeLoops_.back();
+    freeLoops_.pop_back();
+    loops_[id] = std::move(loop);
+  }
+  int head = loops_[id].head;
+  for (int member = head;; member = plan_[member].next) {
+    loopOf_[member] = id;
+    if (member == tail) {
+      break;
+    }
+  }
+  plan_[head].loop = id;
+}
+
+int Cfg::loopTail(int slot) const {
+  for (int i = 0; kept(slot) && i <= CountedLoop::kMaxLength; ++i) {
+    const ExecLine& entry = plan_[slot];
+    if (entry.kind == StmtKind::IF) {
+      return slot;
+    }
+    if (entry.kind != StmtKind::LET) {
+      break;
+    }
+    slot = entry.next;
+  }
+  return -1;
+}
+
+void Cfg::print(const Recorder& recorder, Output& out) const {
+  const std::vector<ExecLine>& slots = recorder.slots();
+  auto slotOf = [&](const ExecLine& entry) {
+    return static_cast<int>(&entry - slots.data());
+  };
+
+  // 从入口出发标记可达的语句
+  std::vector<char> live(plan_.size(), 0);
+  std::vector<int> pending;
+  auto visit = [&](int slot) {
+    if (kept(slot) && !live[slot]) {
+      live[slot] = 1;
+      pending.push_back(slot);
+    }
+  };
+  visit(entry_);
+  while (!pending.empty()) {
+    const ExecLine& entry = plan_[pending.back()];
+    pending.pop_back();
+    if (isJump(entry.kind)) {
+      visit(entry.target);
+    }
+    if (entry.kind != StmtKind::END && entry.kind != StmtKind::GOTO) {
+      visit(entry.next);
+    }
+  }
+
+  // 可达的语句按行号排列，在这个顺序上划分基本块：入口、跳转目标、跳转
+  // 或 END 之后的行以及顺序后继不相邻处开始新的块
+  std::vector<int> order;
+  std::vector<int> position(plan_.size(), -1);
+  recorder.forEach([&](const ExecLine& entry) {
+    int slot = slotOf(entry);
+    if (live[slot]) {
+      position[slot] = static_cast<int>(order.size());
+      order.push_back(slot);
+    }
+  });
+  int size = static_cast<int>(order.size());
+  std::vector<char> leader(size, 0);
+  if (entry_ >= 0) {
+    leader[position[entry_]] = 1;
+  }
+  for (int i = 0; i < size; ++i) {
+    const ExecLine& entry = plan_[order[i]];
+    int next = entry.next >= 0 ? position[entry.next] : -1;
+    if (isJump(entry.kind) && kept(entry.target)) {
+      leader[position[entry.target]] = 1;
+    }
+    if (next >= 0 && next != i + 1) {
+      leader[next] = 1;
+    }
+    bool ends = isJump(entry.kind) || entry.kind == StmtKind::END ||
+                next != i + 1;
+    if (ends && i + 1 < size) {
+      leader[i + 1] = 1;
+    }
+  }
+
+  // 后继写作首行行号，程序末尾为 END
+  auto successor = [&](int slot) {
+    out << ' ';
+    if (kept(slot)) {
+      out << slots[slot].line;
+    } else {
+      out << "END";
+    }
+  };
+  out << "ENTRY";
+  successor(entry_);
+  out << '\n';
+  for (int first = 0; first < size;) {
+    int last = first;
+    while (last + 1 < size && !leader[last + 1]) {
+      ++last;
+    }
+    out << "BLOCK " << plan_[order[first]].line;
+    if (last != first) {
+      out << '-' << plan_[order[last]].line;
+    }
+    out << " ->";
+    const ExecLine& entry = plan_[order[last]];
+    if (isJump(entry.kind)) {
+      // 先写跳转目标；目标行不存在时写出报错的行号
+      if (entry.target < 0) {
+        out << " ERROR " << jumpLine(entry);
+      } else {
+        successor(entry.target);
+      }
+    }
+    if (entry.kind == StmtKind::END) {
+      out << " END";
+    } else if (entry.kind != StmtKind::GOTO) {
+      successor(entry.next);
+    }
+    out << '\n';
+    first = last + 1;
+  }
+  for (int slot : order) {
+    int id = loopOf_[slot];
+    if (id >= 0 && loops_[id].tail == slot) {
+      const CountedLoop& loop = loops_[id];
+      out << "LOOP " << plan_[loop.head].line << '-' << plan_[loop.tail].line;
+      if (loop.closed) {
+        out << " CLOSED";
+      }
+      out << '\n';
+    }
+  }
+
+  // 沿原来的边走到第一条执行的语句，途中经过 GOTO 才算穿透；走过的行
+  // 记下结果，没有走过的非 REM 行即为不可达
+  std::vector<signed char> via(plan_.size(), -1);
+  std::vector<int> path;
+  auto through = [&](int slot) {
+    path.clear();
+    while (slot >= 0 && via[slot] < 0 && !kept(slot)) {
+      path.push_back(slot);
+      const ExecLine& entry = slots[slot];
+      slot = entry.kind == StmtKind::REM ? entry.next : entry.target;
+    }
+    bool result = slot >= 0 && via[slot] > 0;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+      result = result || slots[*it].kind == StmtKind::GOTO;
+      via[*it] = result;
+    }
+    return result;
+  };
+  auto lineOf = [&](int slot) { return slot >= 0 ? slots[slot].line : -1; };
+  std::vector<Thread> threads;
+  through(recorder.head());
+  for (int slot : order) {
+    const ExecLine& entry = slots[slot];
+    int next = -1;
+    if (entry.kind != StmtKind::END && entry.kind != StmtKind::GOTO) {
+      next = entry.next;
+      int to = plan_[slot].next;
+      if (next >= 0 && to != next && through(next)) {
+        threads.push_back(Thread{entry.line, slots[next].line, lineOf(to)});
+      }
+    }
+    if (!isJump(entry.kind) || entry.target < 0) {
+      continue;
+    }
+    int target = entry.target;
+    int to = resolved_[target];
+    // IF 的两条边经过同一行时只记一次
+    if (to != target && through(target) && target != next) {
+      threads.push_back(Thread{entry.line, slots[target].line, lineOf(to)});
+    }
+  }
+  for (const Thread& thread : threads) {
+    out << "THREAD " << thread.from << ' ' << thread.via << " ->";
+    if (thread.to < 0) {
+      out << " END";
+    } else {
+      out << ' ' << thread.to;
+    }
+    out << '\n';
+  }
+
+  std::vector<int> rems;
+  std::vector<int> unreachable;
+  recorder.forEach([&](const ExecLine& entry) {
+    int slot = slotOf(entry);
+    if (live[slot]) {
+      return;
+    }
+    if (entry.kind == StmtKind::REM) {
+      rems.push_back(entry.line);
+    } else if (via[slot] < 0) {
+      unreachable.push_back(entry.line);
+    }
+  });
+  auto lines = [&](const char* title, const std::vector<int>& list) {
+    if (list.empty()) {
+      return;
+    }
+    out << title;
+    for (int line : list) {
+      out << ' ' << line;
+    }
+    out << '\n';
+  };
+  lines("REM", rems);
+  lines("UNREACHABLE", unreachable);
+}
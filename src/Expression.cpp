@@ -1,45 +1,218 @@
 #include "Expression.hpp"
 
+#include <algorithm>
+
+#include "Arena.hpp"
 #include "VarState.hpp"
 #include "utils/Error.hpp"
 
 ConstExpression::ConstExpression(int value) : value_(value) {}
 
-int ConstExpression::evaluate(const VarState&) const { return value_; }
+arith::Word ConstExpression::evaluate(const VarState&, Fault&) const {
+#ifdef BASIC_EVAL_STATS
+  countEvaluation();
+#endif
+  return value_;
+}
 
-VariableExpression::VariableExpression(std::string name)
-    : name_(std::move(name)) {}
+VariableExpression::VariableExpression(int slot) : slot_(slot) {}
 
-int VariableExpression::evaluate(const VarState& state) const {
-  return state.getValue(name_);
+arith::Word VariableExpression::evaluate(const VarState& state,
+                                         Fault& fault) const {
+#ifdef BASIC_EVAL_STATS
+  countEvaluation();
+#endif
+  return state.getValue(slot_, fault);
 }
 
 CompoundExpression::CompoundExpression(Expression* left, char op,
                                        Expression* right)
     : left_(left), right_(right), op_(op) {}
 
-CompoundExpression::~CompoundExpression() {
-  delete left_;
-  delete right_;
+arith::Word CompoundExpression::evaluate(const VarState& state,
+                                         Fault& fault) const {
+#ifdef BASIC_EVAL_STATS
+  countEvaluation();
+#endif
+  arith::Word lhs = left_->evaluate(state, fault);
+  arith::Word rhs = right_->evaluate(state, fault);
+
+  switch (op_) {
+    case '+':
+      return arith::add(lhs, rhs, fault);
+    case '-':
+      return arith::sub(lhs, rhs, fault);
+    case '*':
+      return arith::mul(lhs, rhs, fault);
+    case '/':
+      return arith::div(lhs, rhs, fault);
+    default:
+      fault.raise(ErrorCode::UNSUPPORTED_OPERATOR);
+      return 0;
+  }
 }
 
-int CompoundExpression::evaluate(const VarState& state) const {
-  int lhs = left_->evaluate(state);
-  int rhs = right_->evaluate(state);
+namespace {
 
-  switch (op_) {
+template <typename Op, typename L>
+Expression* withRight(Arena& arena, Expression* left, Expression* right) {
+  switch (right->kind()) {
+    case ExprKind::VARIABLE:
+      return arena.make<BinOp<Op, L, expr::Var>>(left, right);
+    case ExprKind::CONST:
+      return arena.make<BinOp<Op, L, expr::Const>>(left, right);
+    default:
+      return arena.make<BinOp<Op, L, expr::Node>>(left, right);
+  }
+}
+
+template <typename Op>
+Expression* withLeft(Arena& arena, Expression* left, Expression* right) {
+  switch (left->kind()) {
+    case ExprKind::VARIABLE:
+      return withRight<Op, expr::Var>(arena, left, right);
+    case ExprKind::CONST:
+      return withRight<Op, expr::Const>(arena, left, right);
+    default:
+      return withRight<Op, expr::Node>(arena, left, right);
+  }
+}
+
+}  // namespace
+
+Expression* makeCompound(Arena& arena, Expression* left, char op,
+                         Expression* right) {
+  switch (op) {
     case '+':
-      return lhs + rhs;
+      return withLeft<expr::Add>(arena, left, right);
     case '-':
-      return lhs - rhs;
+      return withLeft<expr::Sub>(arena, left, right);
     case '*':
-      return lhs * rhs;
+      return withLeft<expr::Mul>(arena, left, right);
     case '/':
-      if (rhs == 0) {
-        throw BasicError("DIVIDE BY ZERO");
-      }
-      return lhs / rhs;
+      return withLeft<expr::Div>(arena, left, right);
     default:
-      throw BasicError("UNSUPPORTED OPERATOR");
+      return arena.make<CompoundExpression>(left, op, right);
+  }
+}
+
+RpnExpression::RpnExpression(CompoundExpression* root, const Instr* code,
+                             uint32_t size, uint32_t maxStack)
+    : CompoundExpression(root->left_, root->op_, root->right_),
+      code_(code),
+      size_(size),
+      maxStack_(maxStack) {}
+
+arith::Word RpnExpression::evaluate(const VarState& state,
+                                    Fault& fault) const {
+  arith::Word local[kLocalStack];
+  arith::Word* stack = maxStack_ <= kLocalStack ? local : scratch(maxStack_);
+  arith::Word* top = stack;  // 下一个空位
+  for (const Instr* ip = code_; ip != code_ + size_; ++ip) {
+#ifdef BASIC_EVAL_STATS
+    countEvaluation();
+#endif
+    switch (ip->op) {
+      case Op::CONST:
+        *top++ = ip->operand;
+        break;
+      case Op::LOAD:
+        *top++ = state.getValue(ip->operand, fault);
+        break;
+      case Op::ADD:
+        --top;
+        top[-1] = expr::Add::apply(top[-1], *top, fault);
+        break;
+      case Op::SUB:
+        --top;
+        top[-1] = expr::Sub::apply(top[-1], *top, fault);
+        break;
+      case Op::MUL:
+        --top;
+        top[-1] = expr::Mul::apply(top[-1], *top, fault);
+        break;
+      case Op::DIV:
+        --top;
+        top[-1] = expr::Div::apply(top[-1], *top, fault);
+        break;
+    }
   }
+  return stack[0];
 }
+
+arith::Word* RpnExpression::scratch(uint32_t size) {
+  // RPN 求值中不会再调用其他表达式，同一线程内不会重入
+  thread_local std::vector<arith::Word> buffer;
+  if (buffer.size() < size) {
+    buffer.resize(size);
+  }
+  return buffer.data();
+}
+
+Expression* RpnExpression::lowerIfDeep(Expression* expr, Arena& arena) {
+  if (expr->kind() != ExprKind::COMPOUND) {
+    return expr;
+  }
+  if (deeperThan(expr, kMaxTreeDepth)) {
+    return lower(static_cast<CompoundExpression*>(expr), arena);
+  }
+  return expr;
+}
+
+// 是否有一条路径上的运算节点多于 limit 个；递归至多 limit 层
+bool RpnExpression::deeperThan(const Expression* expr, int limit) {
+  if (expr->kind() != ExprKind::COMPOUND) {
+    return false;
+  }
+  if (limit == 0) {
+    return true;
+  }
+  auto* compound = static_cast<const CompoundExpression*>(expr);
+  return deeperThan(compound->left(), limit - 1) ||
+         deeperThan(compound->right(), limit - 1);
+}
+
+RpnExpression* RpnExpression::lower(CompoundExpression* root, Arena& arena) {
+  std::vector<Instr> code;
+  uint32_t depth = 0;
+  uint32_t maxStack = 0;
+  PostorderWalker().walk(root, [&](const Expression* node) {
+    switch (node->kind()) {
+      case ExprKind::CONST:
+        code.push_back(
+            Instr{Op::CONST, static_cast<const ConstExpression*>(node)->value()});
+        maxStack = std::max(maxStack, ++depth);
+        break;
+      case ExprKind::VARIABLE:
+        code.push_back(
+            Instr{Op::LOAD, static_cast<const VariableExpression*>(node)->slot()});
+        maxStack = std::max(maxStack, ++depth);
+        break;
+      case ExprKind::COMPOUND:
+        switch (static_cast<const CompoundExpression*>(node)->op()) {
+          case '+':
+            code.push_back(Instr{Op::ADD, 0});
+            break;
+          case '-':
+            code.push_back(Instr{Op::SUB, 0});
+            break;
+          case '*':
+            code.push_back(Instr{Op::MUL, 0});
+            break;
+          case '/':
+            code.push_back(Instr{Op::DIV, 0});
+            break;
+          default:
+            throw BasicError("UNSUPPORTED OPERATOR");
+        }
+        --depth;
+        break;
+    }
+  });
+  auto* instrs = static_cast<Instr*>(
+      arena.allocate(code.size() * sizeof(Instr), alignof(Instr)));
+  std::copy(code.begin(), code.end(), instrs);
+  return arena.make<RpnExpression>(root, instrs,
+                                   static_cast<uint32_t>(code.size()), maxStack);
+}
+
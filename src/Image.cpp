@@ -0,0 +1,414 @@
+#include "Image.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Arena.hpp"
+#include "Expression.hpp"
+#include "SymbolTable.hpp"
+#include "utils/Error.hpp"
+
+namespace {
+
+// 文件依次为：Header、SymbolRecord[symbols]、LineRecord[lines]、
+// NodeRecord[nodes]、文本区。各段长度都是 4 的倍数，整数按本机字节序存放。
+constexpr char kMagic[8] = {'B', 'A', 'S', 'I', 'C', 'I', 'M', 'G'};
+// 以本机字节序写入，读出的值不同说明映像来自字节序不同的机器
+constexpr uint32_t kByteOrder = 0x01020304;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t symbols;
+  uint32_t lines;
+  uint32_t nodes;
+  uint32_t textSize;
+};
+
+// 变量名在文本区中的位置；表达式与语句以下标引用，载入时统一驻留
+struct SymbolRecord {
+  uint32_t offset;
+  uint32_t length;
+};
+
+struct LineRecord {
+  int32_t line;
+  uint8_t kind;      // StmtKind
+  char op;           // IF 的比较运算符
+  uint16_t reserved;
+  int32_t operand;   // LET/INPUT 的变量下标
+  int32_t target;    // GOTO/IF 的目标行号
+  uint32_t firstNode;
+  uint32_t leftNodes;  // IF 左侧表达式的节点数，其余属于右侧
+  uint32_t nodeCount;
+  uint32_t textOffset;
+  uint32_t textLength;
+};
+
+// 表达式按后序排列：运算节点之前依次是左、右操作数
+struct NodeRecord {
+  uint8_t kind;  // ExprKind
+  char op;
+  uint16_t reserved;
+  int32_t value;  // 常量值或变量下标
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 32);
+static_assert(sizeof(SymbolRecord) == 8 && sizeof(LineRecord) == 36 &&
+              sizeof(NodeRecord) == 8);
+
+class Writer {
+ public:
+  explicit Writer(const SymbolTable& symbols) : symbolTable_(symbols) {}
+
+  void add(const ExecLine& entry) {
+    const Statement* stmt = entry.stmt;
+    LineRecord record{};
+    record.line = entry.line;
+    record.kind = static_cast<uint8_t>(stmt->kind());
+    record.firstNode = static_cast<uint32_t>(nodes_.size());
+    switch (stmt->kind()) {
+      case StmtKind::LET: {
+        auto* let = static_cast<const LetStatement*>(stmt);
+        record.operand = symbol(let->varSlot());
+        expression(let->expression());
+        break;
+      }
+      case StmtKind::PRINT:
+        expression(static_cast<const PrintStatement*>(stmt)->expression());
+        break;
+      case StmtKind::INPUT:
+        record.operand =
+            symbol(static_cast<const InputStatement*>(stmt)->varSlot());
+        break;
+      case StmtKind::GOTO:
+        record.target = static_cast<const GotoStatement*>(stmt)->targetLine();
+        break;
+      case StmtKind::IF: {
+        auto* branch = static_cast<const IfStatement*>(stmt);
+        expression(branch->left());
+        record.leftNodes =
+            static_cast<uint32_t>(nodes_.size()) - record.firstNode;
+        expression(branch->right());
+        record.op = branch->op();
+        record.target = branch->targetLine();
+        break;
+      }
+      default:
+        break;
+    }
+    record.nodeCount = static_cast<uint32_t>(nodes_.size()) - record.firstNode;
+    record.textOffset = text(stmt->text());
+    record.textLength = static_cast<uint32_t>(stmt->text().size());
+    lines_.push_back(record);
+  }
+
+  std::string finish() {
+    // 文本区补齐到 4 字节，整个文件长度保持对齐
+    text_.resize((text_.size() + 3) & ~size_t{3}, '\0');
+    if (text_.size() > std::numeric_limits<uint32_t>::max()) {
+      throw BasicError("CANNOT WRITE FILE");
+    }
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = Image::kVersion;
+    header.byteOrder = kByteOrder;
+    header.symbols = static_cast<uint32_t>(symbols_.size());
+    header.lines = static_cast<uint32_t>(lines_.size());
+    header.nodes = static_cast<uint32_t>(nodes_.size());
+    header.textSize = static_cast<uint32_t>(text_.size());
+
+    std::string image;
+    image.reserve(sizeof(header) + symbols_.size() * sizeof(SymbolRecord) +
+                  lines_.size() * sizeof(LineRecord) +
+                  nodes_.size() * sizeof(NodeRecord) + text_.size());
+    append(image, &header, sizeof(header));
+    append(image, symbols_.data(), symbols_.size() * sizeof(SymbolRecord));
+    append(image, lines_.data(), lines_.size() * sizeof(LineRecord));
+    append(image, nodes_.data(), nodes_.size() * sizeof(NodeRecord));
+    image += text_;
+    return image;
+  }
+
+ private:
+  static void append(std::string& out, const void* data, size_t size) {
+    out.append(static_cast<const char*>(data), size);
+  }
+
+  int32_t symbol(int slot) {
+    auto [it, inserted] =
+        symbolIndex_.emplace(slot, static_cast<int32_t>(symbols_.size()));
+    if (inserted) {
+      const std::string& name = symbolTable_.name(slot);
+      symbols_.push_back(SymbolRecord{text(name),
+                                      static_cast<uint32_t>(name.size())});
+    }
+    return it->second;
+  }
+
+  uint32_t text(std::string_view content) {
+    auto offset = static_cast<uint32_t>(text_.size());
+    text_.append(content);
+    return offset;
+  }
+
+  void expression(const Expression* expr) {
+    walker_.walk(expr, [this](const Expression* node) {
+      NodeRecord record{};
+      record.kind = static_cast<uint8_t>(node->kind());
+      switch (node->kind()) {
+        case ExprKind::CONST:
+          record.value = static_cast<const ConstExpression*>(node)->value();
+          break;
+        case ExprKind::VARIABLE:
+          record.value =
+              symbol(static_cast<const VariableExpression*>(node)->slot());
+          break;
+        case ExprKind::COMPOUND:
+          record.op = static_cast<const CompoundExpression*>(node)->op();
+          break;
+      }
+      nodes_.push_back(record);
+    });
+  }
+
+  std::vector<SymbolRecord> symbols_;
+  std::vector<LineRecord> lines_;
+  std::vector<NodeRecord> nodes_;
+  std::string text_;
+  const SymbolTable& symbolTable_;
+  // 槽位到映像内变量下标
+  std::unordered_map<int, int32_t> symbolIndex_;
+  PostorderWalker walker_;
+};
+
+[[noreturn]] void invalid() { throw BasicError("INVALID IMAGE"); }
+
+// 映射的文件按页对齐，但调用者也可能传入任意缓冲区，按字节拷贝读取记录
+template <typename T>
+T read(const char* base, size_t index) {
+  T value;
+  std::memcpy(&value, base + index * sizeof(T), sizeof(T));
+  return value;
+}
+
+class Reader {
+ public:
+  Reader(std::string_view image, SymbolTable& symbols, bool fused)
+      : fused_(fused) {
+    if (image.size() < sizeof(Header)) {
+      invalid();
+    }
+    Header header;
+    std::memcpy(&header, image.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != Image::kVersion || header.byteOrder != kByteOrder) {
+      invalid();
+    }
+    // 按 64 位计算各段的结束位置，避免损坏的计数造成回绕
+    uint64_t offset = sizeof(Header);
+    symbols_ = section(image, offset, header.symbols, sizeof(SymbolRecord));
+    lines_ = section(image, offset, header.lines, sizeof(LineRecord));
+    nodes_ = section(image, offset, header.nodes, sizeof(NodeRecord));
+    text_ = section(image, offset, header.textSize, 1);
+    if (offset != image.size()) {
+      invalid();
+    }
+    lineCount_ = header.lines;
+    nodeCount_ = header.nodes;
+    textSize_ = header.textSize;
+    // 全部行的原文与节点放在同一个 Arena 中，只分配一次；
+    // 按最大的节点估算，未用到的尾部不会被访问
+    arena_ = std::make_shared<Arena>(
+        Arena::kMinChunk + textSize_ +
+        uint64_t{nodeCount_} * kMaxCompoundSize);
+
+    // 变量名只在这里驻留一次，之后按下标查表
+    slots_.reserve(header.symbols);
+    for (uint32_t i = 0; i < header.symbols; ++i) {
+      auto record = read<SymbolRecord>(symbols_, i);
+      slots_.push_back(
+          symbols.intern(text(record.offset, record.length)));
+    }
+  }
+
+  Recorder::Batch statements() {
+    Recorder::Batch result;
+    result.reserve(lineCount_);
+    for (uint32_t i = 0; i < lineCount_; ++i) {
+      auto record = read<LineRecord>(lines_, i);
+      result.emplace_back(record.line, statement(record));
+    }
+    return result;
+  }
+
+ private:
+  static const char* section(std::string_view image, uint64_t& offset,
+                             uint32_t count, size_t size) {
+    uint64_t begin = offset;
+    offset += uint64_t{count} * size;
+    if (offset > image.size()) {
+      invalid();
+    }
+    return image.data() + begin;
+  }
+
+  std::string_view text(uint32_t offset, uint32_t length) const {
+    if (uint64_t{offset} + length > textSize_) {
+      invalid();
+    }
+    return {text_ + offset, length};
+  }
+
+  int slot(int32_t index) const {
+    if (index < 0 || static_cast<size_t>(index) >= slots_.size()) {
+      invalid();
+    }
+    return slots_[index];
+  }
+
+  std::unique_ptr<Statement> statement(const LineRecord& record) {
+    if (uint64_t{record.firstNode} + record.nodeCount > nodeCount_ ||
+        record.leftNodes > record.nodeCount) {
+      invalid();
+    }
+    std::string_view source =
+        arena_->copy(text(record.textOffset, record.textLength));
+
+    std::unique_ptr<Statement> stmt;
+    uint32_t first = record.firstNode;
+    switch (static_cast<StmtKind>(record.kind)) {
+      case StmtKind::LET:
+        stmt.reset(LetStatement::create(source, slot(record.operand),
+                                        expression(first, record.nodeCount),
+                                        fused_));
+        break;
+      case StmtKind::PRINT:
+        stmt = std::make_unique<PrintStatement>(
+            source, expression(first, record.nodeCount));
+        break;
+      case StmtKind::INPUT:
+        stmt = std::make_unique<InputStatement>(source, slot(record.operand));
+        break;
+      case StmtKind::GOTO:
+        stmt = std::make_unique<GotoStatement>(source, record.target);
+        break;
+      case StmtKind::IF: {
+        if (record.op != '=' && record.op != '<' && record.op != '>') {
+          invalid();
+        }
+        Expression* left = expression(first, record.leftNodes);
+        Expression* right = expression(first + record.leftNodes,
+                                       record.nodeCount - record.leftNodes);
+        stmt.reset(IfStatement::create(source, left, record.op, right,
+                                       record.target, fused_));
+        break;
+      }
+      case StmtKind::REM:
+        stmt = std::make_unique<RemStatement>(source);
+        break;
+      case StmtKind::END:
+        stmt = std::make_unique<EndStatement>(source);
+        break;
+      case StmtKind::INDENT:
+        stmt = std::make_unique<IndentStatement>(source);
+        break;
+      case StmtKind::DEDENT:
+        stmt = std::make_unique<DedentStatement>(source);
+        break;
+      default:
+        invalid();
+    }
+    stmt->shareArena(arena_);
+    return stmt;
+  }
+
+  // 由后序节点重建一棵表达式树，节点必须恰好组成一棵树
+  Expression* expression(uint32_t first, uint32_t count) {
+    stack_.clear();
+    for (uint32_t i = first; i < first + count; ++i) {
+      auto node = read<NodeRecord>(nodes_, i);
+      switch (static_cast<ExprKind>(node.kind)) {
+        case ExprKind::CONST:
+          stack_.push_back(arena_->make<ConstExpression>(node.value));
+          break;
+        case ExprKind::VARIABLE:
+          stack_.push_back(arena_->make<VariableExpression>(slot(node.value)));
+          break;
+        case ExprKind::COMPOUND: {
+          if (stack_.size() < 2 || std::strchr("+-*/", node.op) == nullptr ||
+              node.op == '\0') {
+            invalid();
+          }
+          Expression* right = stack_.back();
+          stack_.pop_back();
+          stack_.back() =
+              makeCompound(*arena_, stack_.back(), node.op, right);
+          break;
+        }
+        default:
+          invalid();
+      }
+    }
+    if (stack_.size() != 1) {
+      invalid();
+    }
+    // 与 Parser 一样，很深的树降为 RPN
+    return RpnExpression::lowerIfDeep(stack_.back(), *arena_);
+  }
+
+  const char* symbols_;
+  const char* lines_;
+  const char* nodes_;
+  const char* text_;
+  uint32_t lineCount_;
+  uint32_t nodeCount_;
+  uint32_t textSize_;
+  std::vector<int> slots_;
+  std::vector<Expression*> stack_;
+  std::shared_ptr<Arena> arena_;
+  bool fused_;
+};
+
+}  // namespace
+
+void Image::save(const Recorder& recorder, const SymbolTable& symbols,
+                 const std::string& path) {
+  Writer writer(symbols);
+  recorder.forEach([&writer](const ExecLine& entry) { writer.add(entry); });
+  std::string image = writer.finish();
+
+  int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    throw BasicError("CANNOT WRITE FILE");
+  }
+  const char* data = image.data();
+  size_t size = image.size();
+  while (size > 0) {
+    ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ::close(fd);
+      throw BasicError("CANNOT WRITE FILE");
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  if (::close(fd) != 0) {
+    throw BasicError("CANNOT WRITE FILE");
+  }
+}
+
+Recorder::Batch Image::load(std::string_view image, SymbolTable& symbols,
+                            bool fused) {
+  return Reader(image, symbols, fused).statements();
+}
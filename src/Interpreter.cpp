@@ -0,0 +1,317 @@
+#include "Interpreter.hpp"
+
+#include <cctype>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "Loader.hpp"
+#include "Statement.hpp"
+#include "Token.hpp"
+
+// 辅助函数：去除前后的空格
+static std::string_view trim(std::string_view s) {
+  size_t start = 0;
+  while (start < s.size() &&
+         std::isspace(static_cast<unsigned char>(s[start]))) {
+    start++;
+  }
+  size_t end = s.size();
+  while (end > start && std::isspace(static_cast<unsigned char>(s[end - 1]))) {
+    end--;
+  }
+  return s.substr(start, end - start);
+}
+
+// 打印帮助信息
+static void printHelp(Output& out) {
+  out << "Supported commands:\n";
+  out << "  General statements (with line number):\n";
+  out << "    REM <comment> - Comment line (ignored)\n";
+  out
+      << "    LET <var> = <expr> - Assign expression result to variable\n";
+  out << "    PRINT <expr> - Evaluate expression and print result\n";
+  out
+      << "    INPUT <var> - Prompt with '?', read integer into variable\n";
+  out << "    END - Terminate program execution\n";
+  out << "    GOTO <line> - Jump to specified line number\n";
+  out << "    IF <expr1> <op> <expr2> THEN <line> - Conditional jump "
+               "(op: =, <, >)\n";
+  out << "    INDENT - Enter a new variable scope\n";
+  out << "    DEDENT - Leave the current variable scope\n";
+  out << "  Immediate execution (without line number): LET, PRINT, INPUT, "
+         "INDENT, DEDENT\n";
+  out << "  Interpreter commands:\n";
+  out << "    RUN - Execute program from lowest line number\n";
+  out << "    RUN VM | RUN TREE - Execute with the bytecode VM or the "
+               "tree walker\n";
+  out << "    RUN JIT - Execute as native code (x86-64 Linux, otherwise "
+               "the VM)\n";
+  out << "    LIST - Display all program lines in order\n";
+  out << "    ANALYZE - Show basic blocks, threaded jumps and removed "
+         "lines\n";
+  out << "    CLEAR - Remove all program lines\n";
+  out << "    LOAD <file> - Enter every line of a file as if typed\n";
+  out << "    PROFILE ON | PROFILE OFF - Toggle per-line profiling of RUN\n";
+  out << "    PROFILE - Show the profile report sorted by cost\n";
+  out << "    PROFILE HITS - Show only the counts, in line order\n";
+  out << "    QUIT - Exit the interpreter\n";
+  out << "    HELP - Show this help message\n";
+}
+
+// 解析 RUN 指令及其可选的引擎参数，不是 RUN 指令时返回 false
+static bool parseRun(std::string_view line, Engine fallback, Engine& engine) {
+  if (line.compare(0, 3, "RUN") != 0) {
+    return false;
+  }
+  if (line.size() > 3 && !std::isspace(static_cast<unsigned char>(line[3]))) {
+    return false;
+  }
+  std::string_view arg = line.size() > 3 ? trim(line.substr(3)) : "";
+  if (arg.empty()) {
+    engine = fallback;
+  } else if (arg == "VM") {
+    engine = Engine::VM;
+  } else if (arg == "TREE") {
+    engine = Engine::TREE;
+  } else if (arg == "JIT") {
+    engine = Engine::JIT;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// 解析 LOAD/SAVEIMG/LOADIMG 等带一个文件参数的指令，不是该指令时返回 false
+static bool parseFileCommand(std::string_view line, std::string_view name,
+                             std::string_view& path) {
+  size_t n = name.size();
+  if (line.size() <= n || line.compare(0, n, name) != 0 ||
+      !std::isspace(static_cast<unsigned char>(line[n]))) {
+    return false;
+  }
+  path = trim(line.substr(n));
+  return true;
+}
+
+// 解析 PROFILE [ON|OFF|HITS] 指令，不是 PROFILE 指令时返回 false
+static bool parseProfile(std::string_view line, std::string_view& arg) {
+  if (line.compare(0, 7, "PROFILE") != 0) {
+    return false;
+  }
+  if (line.size() > 7 && !std::isspace(static_cast<unsigned char>(line[7]))) {
+    return false;
+  }
+  arg = line.size() > 7 ? trim(line.substr(7)) : "";
+  return arg.empty() || arg == "ON" || arg == "OFF" || arg == "HITS";
+}
+
+bool Interpreter::isCommand(std::string_view line) noexcept {
+  std::string_view trimmed = trim(line);
+  Engine engine;
+  std::string_view arg;
+  return trimmed == "QUIT" || trimmed == "LIST" || trimmed == "CLEAR" ||
+         trimmed == "HELP" || trimmed == "ANALYZE" ||
+         parseRun(trimmed, Engine::TREE, engine) ||
+         parseFileCommand(trimmed, "LOAD", arg) ||
+         parseFileCommand(trimmed, "SAVEIMG", arg) ||
+         parseFileCommand(trimmed, "LOADIMG", arg) || parseProfile(trimmed, arg);
+}
+
+bool Interpreter::processLine(std::string_view line) {
+  std::string_view trimmedLine = trim(line);
+  if (trimmedLine.empty()) {
+    return true;
+  }
+  // 优先处理解释器指令
+  if (isCommand(trimmedLine)) {
+    return runCommand(trimmedLine);
+  }
+  // 处理其他语句
+  try {
+    TokenStream tokens = lexer_.tokenize(line);
+    if (tokens.empty()) {
+      return true;
+    }
+    ParsedLine parsedLine = parser_.parseLine(tokens, line);
+    apply(parsedLine.getLine(), parsedLine.fetchStatement());
+  } catch (const BasicError& e) {
+    report(e);
+  }
+  return true;
+}
+
+bool Interpreter::runCommand(std::string_view command) {
+  Output& out = program_.output();
+  Engine engine;
+  std::string_view arg;
+  if (command == "QUIT") {
+    out.flush();
+    return false;
+  } else if (parseRun(command, program_.engine(), engine)) {
+    if (resumable_) {
+      program_.start(engine);
+      return true;
+    }
+    try {
+      program_.run(engine);
+    } catch (const BasicError& e) {
+      report(e);
+    }
+  } else if (command == "LIST") {
+    program_.list();
+  } else if (command == "ANALYZE") {
+    program_.analyze();
+  } else if (command == "CLEAR") {
+    program_.clear();
+  } else if (command == "HELP") {
+    printHelp(out);
+  } else if (parseFileCommand(command, "LOAD", arg)) {
+    try {
+      return load(std::string(arg));
+    } catch (const BasicError& e) {
+      report(e);
+    }
+  } else if (parseFileCommand(command, "SAVEIMG", arg)) {
+    try {
+      program_.saveImage(std::string(arg));
+    } catch (const BasicError& e) {
+      report(e);
+    }
+  } else if (parseFileCommand(command, "LOADIMG", arg)) {
+    try {
+      program_.loadImage(std::string(arg));
+    } catch (const BasicError& e) {
+      report(e);
+    }
+  } else if (parseProfile(command, arg)) {
+    if (arg.empty() || arg == "HITS") {
+      program_.printProfile(arg.empty());
+    } else {
+      program_.setProfiling(arg == "ON");
+    }
+  }
+  return true;
+}
+
+void Interpreter::setResumable(bool enabled) noexcept {
+  resumable_ = enabled;
+  program_.setSuspendInput(enabled);
+}
+
+bool Interpreter::load(const std::string& path) {
+  if (resumable_) {
+    throw BasicError("LOAD NOT SUPPORTED");
+  }
+  if (loadDepth_ >= kMaxLoadDepth) {
+    throw BasicError("LOAD NESTED TOO DEEP");
+  }
+  MappedFile file(path);
+  // 词法与语法分析与程序状态无关，可以先并行完成
+  Loader loader(parser_, &Interpreter::isCommand);
+  std::vector<LoadedLine> lines = loader.parse(file.contents());
+
+  // 再按文件顺序合并：同一行号后写者生效，错误与指令在原位置处理。
+  // INPUT 读走的行会推进 next，这些行不再合并
+  ++loadDepth_;
+  loading_.push_back(LoadFrame{&lines, 0});
+  bool suspended = program_.suspendInput();
+  program_.setSuspendInput(true);
+  bool proceed = true;
+  Engine engine;
+  while (loading_.back().next < lines.size()) {
+    LoadedLine& entry = lines[loading_.back().next++];
+    switch (entry.kind) {
+      case LoadedLine::Kind::EMPTY:
+        break;
+      case LoadedLine::Kind::COMMAND:
+        if (parseRun(trim(entry.text), program_.engine(), engine)) {
+          runLoaded(engine);
+        } else {
+          proceed = runCommand(trim(entry.text));
+        }
+        break;
+      case LoadedLine::Kind::PARSED:
+        try {
+          apply(entry.line, entry.stmt.release());
+        } catch (const BasicError& e) {
+          report(e);
+        }
+        // 立即执行的 INPUT
+        while (program_.awaitingInput() && feedInput()) {
+        }
+        break;
+      case LoadedLine::Kind::ERROR:
+        program_.output() << entry.error << '\n';
+        program_.output().flush();
+        break;
+    }
+    if (!proceed) {
+      break;
+    }
+  }
+  program_.setSuspendInput(suspended);
+  loading_.pop_back();
+  --loadDepth_;
+  return proceed;
+}
+
+void Interpreter::runLoaded(Engine engine) {
+  RunStatus status = RunStatus::FINISHED;
+  try {
+    program_.start(engine);
+    status = program_.resume();
+    while (status == RunStatus::NEEDS_INPUT && feedInput()) {
+      status = program_.resume();
+    }
+  } catch (const BasicError& e) {
+    report(e);
+  }
+  if (status == RunStatus::ERROR) {
+    program_.output() << program_.lastError() << '\n';
+  }
+  program_.output().flush();
+}
+
+bool Interpreter::feedInput() {
+  std::string line;
+  bool found = false;
+  for (auto it = loading_.rbegin(); it != loading_.rend() && !found; ++it) {
+    if (it->next < it->lines->size()) {
+      line = (*it->lines)[it->next++].text;
+      found = true;
+    }
+  }
+  if (!found) {
+    program_.output().flush(); // 阻塞读取前写出提示符
+    found = static_cast<bool>(std::getline(std::cin, line));
+  }
+  if (!found) {
+    program_.stop();
+    return false;
+  }
+  // 不合法的值输出 INVALID NUMBER 后仍在等待，由下一行重试
+  program_.provideInput(line);
+  return true;
+}
+
+void Interpreter::apply(std::optional<int> line, Statement* stmt) {
+  if (line.has_value()) {
+    // 带行号的语句：若语句为空，删除；否则添加更新
+    if (stmt == nullptr) {
+      program_.removeStmt(line.value());
+    } else {
+      program_.addStmt(line.value(), stmt);
+    }
+    return;
+  }
+  if (stmt != nullptr) {
+    std::unique_ptr<Statement> owned(stmt);
+    program_.execute(stmt);
+  }
+}
+
+void Interpreter::report(const BasicError& error) {
+  program_.output() << error.message() << '\n';
+  program_.output().flush();
+}
@@ -0,0 +1,995 @@
+#include "Jit.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Arith.hpp"
+#include "Bytecode.hpp"
+#include "Output.hpp"
+#include "Statement.hpp"
+#include "VM.hpp"
+#include "VarState.hpp"
+
+#if defined(__x86_64__) && defined(__linux__)
+#define BASIC_JIT_X86_64 1
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#endif
+
+// 本机代码与运行时共享的状态，执行期间 rbx 始终指向它
+struct JitFrame {
+  int* values;
+  uint64_t* defined;
+  VarState* state;
+  Output* out;
+  // 跳转表，执行期间在 r14 中
+  const uintptr_t* table;
+  // 剩余的语句预算，执行期间在 r15 中
+  uint64_t budget;
+  // 序言结束时的 rsp：出错退出与 PRINT 中途放弃时据此丢弃操作数栈
+  void* stack;
+  // 当前作用域层数，为 0 时赋值直接写数组，否则调用 setValue 记录遮蔽
+  int32_t scopes;
+  int32_t error;
+  int32_t payload;
+  // 进入与返回时的字节码偏移，以及返回原因（JitExit）
+  int32_t ip;
+  int32_t exit;
+  // 非 0 时 INPUT 暂停返回，目标槽位写入 payload
+  int32_t suspend;
+};
+
+namespace {
+
+// 每段可执行内存的最小大小；作废的代码超过它且多于使用中的代码时整体丢弃
+constexpr size_t kChunkSize = 1 << 20;
+
+#ifdef BASIC_JIT_X86_64
+
+// 供本机代码调用的运行时入口。调用发生在语句边界，操作数栈为空；
+// 本机代码没有展开信息，这些函数不能抛出异常
+void jitPrint(JitFrame* frame, arith::Word value) noexcept {
+  *frame->out << value << '\n';
+}
+
+void jitUndefined(JitFrame* frame) noexcept {
+  *frame->out << "VARIABLE NOT DEFINED\n";
+}
+
+void jitStore(JitFrame* frame, int slot, int value) noexcept {
+  frame->state->setValue(slot, value);
+}
+
+void jitInput(JitFrame* frame, int slot) noexcept {
+  frame->state->setValue(slot, InputStatement::readValue(*frame->out));
+}
+
+void jitEnter(JitFrame* frame) noexcept {
+  frame->state->enterScope();
+  ++frame->scopes;
+}
+
+// 已在全局作用域时返回非 0
+int jitExit(JitFrame* frame) noexcept {
+  Fault fault;
+  frame->state->exitScope(fault);
+  if (fault) {
+    return 1;
+  }
+  --frame->scopes;
+  return 0;
+}
+
+enum Reg : uint8_t {
+  RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+  R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+// 条件跳转的条件码
+enum Cond : uint8_t {
+  O = 0x0, B = 0x2, NC = 0x3, E = 0x4, NE = 0x5, L = 0xC, G = 0xF
+};
+
+// 只实现翻译用到的指令。wide 为真时使用 64 位操作数（REX.W）
+class Assembler {
+ public:
+  size_t size() const noexcept { return code_.size(); }
+  const std::vector<uint8_t>& code() const noexcept { return code_; }
+
+  void push(Reg r) {
+    rex(false, 0, r);
+    byte(0x50 | (r & 7));
+  }
+
+  void pop(Reg r) {
+    rex(false, 0, r);
+    byte(0x58 | (r & 7));
+  }
+
+  // op rm, reg：01 add、29 sub、39 cmp、85 test、87 xchg、89 mov
+  void alu(uint8_t op, bool wide, Reg rm, Reg reg) {
+    rex(wide, reg, rm);
+    byte(op);
+    direct(reg, rm);
+  }
+
+  void imul(bool wide, Reg dst, Reg src) {
+    rex(wide, dst, src);
+    byte(0x0F);
+    byte(0xAF);
+    direct(dst, src);
+  }
+
+  // F7 组：/3 neg、/7 idiv
+  void unary(uint8_t ext, bool wide, Reg r) {
+    rex(wide, 0, r);
+    byte(0xF7);
+    direct(ext, r);
+  }
+
+  // 83 组：/0 add、/5 sub、/7 cmp
+  void aluImm8(uint8_t ext, bool wide, Reg r, int8_t value) {
+    rex(wide, 0, r);
+    byte(0x83);
+    direct(ext, r);
+    byte(static_cast<uint8_t>(value));
+  }
+
+  // cdq / cqo
+  void signExtend(bool wide) {
+    if (wide) {
+      byte(0x48);
+    }
+    byte(0x99);
+  }
+
+  // 64 位时按符号扩展
+  void movImm(bool wide, Reg r, int32_t value) {
+    if (wide) {
+      rex(true, 0, r);
+      byte(0xC7);
+      direct(0, r);
+    } else {
+      rex(false, 0, r);
+      byte(0xB8 | (r & 7));
+    }
+    imm32(value);
+  }
+
+  void movImm64(Reg r, uint64_t value) {
+    rex(true, 0, r);
+    byte(0xB8 | (r & 7));
+    imm64(value);
+  }
+
+  void movsxd(Reg dst, Reg src) {
+    rex(true, dst, src);
+    byte(0x63);
+    direct(dst, src);
+  }
+
+  // 以下内存操作数均为 [base + disp32]
+  void load(bool wide, Reg dst, Reg base, int32_t disp) {
+    rex(wide, dst, base);
+    byte(0x8B);
+    memory(dst, base, disp);
+  }
+
+  void loadSigned(Reg dst, Reg base, int32_t disp) {
+    rex(true, dst, base);
+    byte(0x63);
+    memory(dst, base, disp);
+  }
+
+  void store(bool wide, Reg base, int32_t disp, Reg src) {
+    rex(wide, src, base);
+    byte(0x89);
+    memory(src, base, disp);
+  }
+
+  void storeImm(Reg base, int32_t disp, int32_t value) {
+    rex(false, 0, base);
+    byte(0xC7);
+    memory(0, base, disp);
+    imm32(value);
+  }
+
+  void cmpMemImm8(Reg base, int32_t disp, int8_t value) {
+    rex(false, 0, base);
+    byte(0x83);
+    memory(7, base, disp);
+    byte(static_cast<uint8_t>(value));
+  }
+
+  // 0F BA 组：/4 bt、/5 bts，作用于 64 位字中的一位
+  void bitOp(uint8_t ext, Reg base, int32_t disp, uint8_t bit) {
+    rex(true, 0, base);
+    byte(0x0F);
+    byte(0xBA);
+    memory(ext, base, disp);
+    byte(bit);
+  }
+
+  void call(Reg r) {
+    rex(false, 0, r);
+    byte(0xFF);
+    direct(2, r);
+  }
+
+  void ret() { byte(0xC3); }
+
+  // jmp [base + disp32]
+  void jumpMemory(Reg base, int32_t disp) {
+    rex(false, 0, base);
+    byte(0xFF);
+    memory(4, base, disp);
+  }
+
+  // jmp [base + index * 8]，base 不能是 rbp 或 r13
+  void jumpIndexed(Reg base, Reg index) {
+    uint8_t prefix = 0x40 | ((index & 8) >> 2) | ((base & 8) >> 3);
+    if (prefix != 0x40) {
+      byte(prefix);
+    }
+    byte(0xFF);
+    byte(4 << 3 | RSP);  // 以 SIB 寻址
+    byte(0xC0 | (index & 7) << 3 | (base & 7));
+  }
+
+  // rel32 跳转，返回待回填的位移所在位置
+  size_t jmp() {
+    byte(0xE9);
+    return hole();
+  }
+
+  size_t jcc(Cond cond) {
+    byte(0x0F);
+    byte(0x80 | cond);
+    return hole();
+  }
+
+  // 把位于 at 的位移指向 target
+  void patch(size_t at, size_t target) {
+    int32_t rel = static_cast<int32_t>(static_cast<int64_t>(target) -
+                                       static_cast<int64_t>(at + 4));
+    std::memcpy(&code_[at], &rel, sizeof rel);
+  }
+
+  void bind(size_t at) { patch(at, size()); }
+
+ private:
+  void byte(uint8_t b) { code_.push_back(b); }
+  void imm32(int32_t value) { append(&value, sizeof value); }
+  void imm64(uint64_t value) { append(&value, sizeof value); }
+
+  void append(const void* data, size_t size) {
+    auto* bytes = static_cast<const uint8_t*>(data);
+    code_.insert(code_.end(), bytes, bytes + size);
+  }
+
+  void rex(bool wide, int reg, int rm) {
+    uint8_t prefix = 0x40 | (wide ? 8 : 0) | ((reg & 8) >> 1) | ((rm & 8) >> 3);
+    if (prefix != 0x40) {
+      byte(prefix);
+    }
+  }
+
+  void direct(int reg, int rm) { byte(0xC0 | (reg & 7) << 3 | (rm & 7)); }
+
+  void memory(int reg, int base, int32_t disp) {
+    byte(0x80 | (reg & 7) << 3 | (base & 7));
+    if ((base & 7) == RSP) {
+      byte(0x24);  // r12 作基址需要 SIB
+    }
+    imm32(disp);
+  }
+
+  size_t hole() {
+    size_t at = size();
+    imm32(0);
+    return at;
+  }
+
+  std::vector<uint8_t> code_;
+};
+
+constexpr bool kWide = arith::kPolicy == arith::Policy::WIDEN;
+constexpr bool kChecked = arith::kPolicy != arith::Policy::WRAP;
+
+// 表达式嵌套超过此深度时不翻译：操作数栈在本机栈上，过深会耗尽线程栈
+constexpr int kMaxDepth = 1 << 14;
+
+// 一块最多翻译的字节码字数，超过后在下一行开头结束：单行更新作废的
+// 代码量因此有上限
+constexpr int32_t kBlockWords = 1024;
+
+// 保存被调用者保存的寄存器（连同返回地址共 48 字节，rsp 仍按 16 字节
+// 对齐），按寄存器约定载入后经跳转表进入 frame->ip
+void prologue(Assembler& as) {
+  as.push(RBX);
+  as.push(R12);
+  as.push(R13);
+  as.push(R14);
+  as.push(R15);
+  as.alu(0x89, true, RBX, RDI);
+  as.store(true, RBX, offsetof(JitFrame, stack), RSP);
+  as.load(true, R12, RBX, offsetof(JitFrame, values));
+  as.load(true, R13, RBX, offsetof(JitFrame, defined));
+  as.load(true, R14, RBX, offsetof(JitFrame, table));
+  as.load(true, R15, RBX, offsetof(JitFrame, budget));
+  as.load(false, RCX, RBX, offsetof(JitFrame, ip));
+  as.jumpIndexed(R14, RCX);
+}
+
+// 写回预算，丢弃操作数栈后返回
+void epilogue(Assembler& as) {
+  as.store(true, RBX, offsetof(JitFrame, budget), R15);
+  as.load(true, RSP, RBX, offsetof(JitFrame, stack));
+  as.pop(R15);
+  as.pop(R14);
+  as.pop(R13);
+  as.pop(R12);
+  as.pop(RBX);
+  as.ret();
+}
+
+// 寄存器约定：rbx 指向 JitFrame，r12 为变量值数组，r13 为定义位图，
+// r14 为跳转表，r15 为剩余预算；操作数栈顶缓存在 rax，其余在本机栈上。
+// 语句之间操作数栈为空，此时 rsp 与 frame->stack 相同且按 16 字节对齐，
+// 可以直接调用运行时。转移到别的块时在 ecx 中带上目标偏移，目标未翻译
+// 时 MISS 出口据此返回
+class Translator {
+ public:
+  // owner 为各偏移已归属的块，已归属的位置经跳转表转移，不重复翻译
+  Translator(const Bytecode& bytecode, const std::vector<int32_t>& owner,
+             bool budgeted)
+      : bytecode_(bytecode), owner_(owner), budgeted_(budgeted) {}
+
+  // 从 start 开始翻译一块。只翻译可达的指令：被单行更新改写过的旧位置
+  // 可能无法解码，线性扫描并不安全
+  bool translate(int32_t start) {
+    pending_.push_back(start);
+    while (!pending_.empty()) {
+      int32_t pc = pending_.back();
+      pending_.pop_back();
+      // 已属于别的块或本块已满的目标留给跳转表
+      if (native_.count(pc) != 0 ||
+          (valid(pc) && (owner_[pc] >= 0 || full()))) {
+        continue;
+      }
+      if (!block(pc)) {
+        return false;
+      }
+    }
+    // 出错与慢速路径放在热代码之后
+    for (size_t i = 0; i < cold_.size(); ++i) {
+      cold_[i]();
+    }
+    for (const auto& [at, target] : jumps_) {
+      auto it = native_.find(target);
+      as_.patch(at, it != native_.end() ? it->second : far(target));
+    }
+    for (size_t at : exits_) {
+      as_.bind(at);
+    }
+    epilogue(as_);
+    return true;
+  }
+
+  const std::vector<uint8_t>& code() const noexcept { return as_.code(); }
+  int slots() const noexcept { return slots_; }
+  // 覆盖的字节码区间、可经跳转表进入的偏移与其本机代码位置、转移目标
+  const std::vector<std::pair<int32_t, int32_t>>& words() const noexcept {
+    return words_;
+  }
+  const std::vector<std::pair<int32_t, size_t>>& entries() const noexcept {
+    return entries_;
+  }
+  const std::vector<int32_t>& targets() const noexcept { return targets_; }
+
+ private:
+  bool valid(int32_t pc) const {
+    return pc >= 0 && static_cast<size_t>(pc) < bytecode_.code.size();
+  }
+
+  bool full() const { return covered_ >= kBlockWords; }
+
+  void cover(int32_t pc, int width) {
+    if (!words_.empty() && words_.back().second == pc) {
+      words_.back().second += width;
+    } else {
+      words_.emplace_back(pc, pc + width);
+    }
+    covered_ += width;
+  }
+
+  // 跳向字节码偏移 target，目标在翻译结束后回填
+  void jumpTo(size_t at, int32_t target) { jumps_.emplace_back(at, target); }
+
+  // 经跳转表转移到 target
+  void transfer(int32_t target) {
+    as_.movImm(false, RCX, target);
+    as_.jumpMemory(R14, target * 8);
+    targets_.push_back(target);
+  }
+
+  // 块外目标共用的转移代码，返回其位置
+  size_t far(int32_t target) {
+    auto [it, inserted] = stubs_.try_emplace(target, as_.size());
+    if (inserted) {
+      transfer(target);
+    }
+    return it->second;
+  }
+
+  void call(void* fn) {
+    as_.alu(0x89, true, RDI, RBX);
+    as_.movImm64(R11, reinterpret_cast<uint64_t>(fn));
+    as_.call(R11);
+  }
+
+  // 记下返回原因与恢复执行的偏移后退出
+  void leave(JitExit exit, int32_t pc) {
+    as_.storeImm(RBX, offsetof(JitFrame, ip), pc);
+    as_.storeImm(RBX, offsetof(JitFrame, exit), static_cast<int32_t>(exit));
+    exits_.push_back(as_.jmp());
+  }
+
+  // 记下错误后退出
+  void fail(size_t at, ErrorCode code, int payload = 0) {
+    cold_.push_back([this, at, code, payload] {
+      as_.bind(at);
+      as_.storeImm(RBX, offsetof(JitFrame, error), static_cast<int32_t>(code));
+      as_.storeImm(RBX, offsetof(JitFrame, payload), payload);
+      as_.storeImm(RBX, offsetof(JitFrame, exit),
+                   static_cast<int32_t>(JitExit::ERROR));
+      exits_.push_back(as_.jmp());
+    });
+  }
+
+  // 每行开头扣一条语句的预算，已用完时恢复为 0 并停在这一行开头
+  void charge(int32_t pc) {
+    as_.aluImm8(5, true, R15, 1);
+    size_t at = as_.jcc(B);
+    cold_.push_back([this, at, pc] {
+      as_.bind(at);
+      as_.aluImm8(0, true, R15, 1);
+      leave(JitExit::BUDGET, pc);
+    });
+  }
+
+  // 分段执行时暂停返回，提供输入后从下一条指令继续
+  void input(int32_t pc, int32_t slot) {
+    as_.cmpMemImm8(RBX, offsetof(JitFrame, suspend), 0);
+    size_t suspend = as_.jcc(NE);
+    as_.movImm(false, RSI, slot);
+    call(reinterpret_cast<void*>(&jitInput));
+    cold_.push_back([this, suspend, pc, slot] {
+      as_.bind(suspend);
+      as_.storeImm(RBX, offsetof(JitFrame, payload), slot);
+      leave(JitExit::INPUT, pc + 2);
+    });
+  }
+
+  bool useSlot(int32_t slot) {
+    if (slot < 0 || slot >= (1 << 28)) {
+      return false;
+    }
+    slots_ = std::max(slots_, slot + 1);
+    return true;
+  }
+
+  static bool hasOperand(OpCode op) {
+    switch (op) {
+      case OpCode::CONST:
+      case OpCode::LOAD:
+      case OpCode::STORE:
+      case OpCode::GUARD:
+      case OpCode::INPUT:
+      case OpCode::JMP:
+      case OpCode::JEQ:
+      case OpCode::JLT:
+      case OpCode::JGT:
+      case OpCode::LINK:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // 从 pc 开始顺序翻译，直到无条件转移或程序结束。块总是从语句边界开始
+  bool block(int32_t pc) {
+    const std::vector<int32_t>& code = bytecode_.code;
+    int depth = 0;
+    int32_t guard = -1;
+    for (;;) {
+      if (!valid(pc)) {
+        return false;
+      }
+      auto known = native_.find(pc);
+      if (known != native_.end()) {
+        if (depth != 0) {
+          return false;
+        }
+        as_.patch(as_.jmp(), known->second);
+        return true;
+      }
+      bool boundary = depth == 0 && guard < 0;
+      if (owner_[pc] >= 0 || (full() && bytecode_.starts[pc] != 0)) {
+        if (!boundary) {
+          return false;
+        }
+        transfer(pc);
+        return true;
+      }
+      native_[pc] = as_.size();
+      if (boundary) {
+        entries_.emplace_back(pc, as_.size());
+      }
+      if (budgeted_ && bytecode_.starts[pc] != 0) {
+        charge(pc);
+      }
+      auto op = static_cast<OpCode>(code[pc]);
+      int width = hasOperand(op) ? 2 : 1;
+      if (!valid(pc + width - 1)) {
+        return false;
+      }
+      int32_t arg = width == 2 ? code[pc + 1] : 0;
+      cover(pc, width);
+      switch (op) {
+        case OpCode::CONST:
+          spill(depth);
+          as_.movImm(kWide, RAX, arg);
+          ++depth;
+          break;
+        case OpCode::LOAD:
+          if (!useSlot(arg)) {
+            return false;
+          }
+          spill(depth);
+          load(arg, guard);
+          ++depth;
+          break;
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::DIV:
+          if (depth < 2) {
+            return false;
+          }
+          arithmetic(op);
+          --depth;
+          break;
+        case OpCode::STORE:
+          if (depth != 1 || !useSlot(arg)) {
+            return false;
+          }
+          store(arg);
+          depth = 0;
+          break;
+        case OpCode::GUARD:
+          if (!valid(arg)) {
+            return false;
+          }
+          guard = arg;
+          pending_.push_back(arg);
+          break;
+        case OpCode::PRINT:
+          if (depth != 1) {
+            return false;
+          }
+          as_.alu(0x89, kWide, RSI, RAX);
+          call(reinterpret_cast<void*>(&jitPrint));
+          depth = 0;
+          guard = -1;
+          break;
+        case OpCode::INPUT:
+          if (depth != 0 || !useSlot(arg)) {
+            return false;
+          }
+          input(pc, arg);
+          break;
+        case OpCode::JMP:
+        case OpCode::LINK:
+          // 接着翻译目标，LINK 链与 GOTO 链因此不产生跳转
+          if (depth != 0) {
+            return false;
+          }
+          pc = arg;
+          continue;
+        case OpCode::JEQ:
+        case OpCode::JLT:
+        case OpCode::JGT:
+          if (depth != 2 || !valid(arg)) {
+            return false;
+          }
+          as_.pop(RCX);
+          as_.alu(0x39, kWide, RCX, RAX);
+          jumpTo(as_.jcc(op == OpCode::JEQ   ? E
+                         : op == OpCode::JLT ? L
+                                             : G),
+                 arg);
+          pending_.push_back(arg);
+          depth = 0;
+          break;
+        case OpCode::INDENT:
+          if (depth != 0) {
+            return false;
+          }
+          call(reinterpret_cast<void*>(&jitEnter));
+          break;
+        case OpCode::DEDENT:
+          if (depth != 0) {
+            return false;
+          }
+          call(reinterpret_cast<void*>(&jitExit));
+          as_.alu(0x85, false, RAX, RAX);
+          fail(as_.jcc(NE), ErrorCode::SCOPE_UNDERFLOW);
+          break;
+        case OpCode::FAIL:
+          fail(as_.jmp(), ErrorCode::LINE_NUMBER_ERROR);
+          return true;
+        case OpCode::HALT:
+          exits_.push_back(as_.jmp());
+          return true;
+        default:
+          return false;
+      }
+      if (depth > kMaxDepth) {
+        return false;
+      }
+      pc += width;
+    }
+  }
+
+  // 压入新值前把栈顶移到本机栈上
+  void spill(int depth) {
+    if (depth > 0) {
+      as_.push(RAX);
+    }
+  }
+
+  void load(int32_t slot, int32_t guard) {
+    as_.bitOp(4, R13, (slot >> 6) * 8, slot & 63);
+    size_t at = as_.jcc(NC);
+    if (kWide) {
+      as_.loadSigned(RAX, R12, slot * 4);
+    } else {
+      as_.load(false, RAX, R12, slot * 4);
+    }
+    if (guard < 0) {
+      fail(at, ErrorCode::VARIABLE_NOT_DEFINED, slot);
+      return;
+    }
+    // PRINT 中：输出提示，丢弃操作数栈后执行下一条语句
+    cold_.push_back([this, at, guard] {
+      as_.bind(at);
+      as_.load(true, RSP, RBX, offsetof(JitFrame, stack));
+      call(reinterpret_cast<void*>(&jitUndefined));
+      jumpTo(as_.jmp(), guard);
+    });
+  }
+
+  // rcx 为左操作数，rax 为右操作数，结果留在 rax
+  void arithmetic(OpCode op) {
+    as_.pop(RCX);
+    switch (op) {
+      case OpCode::ADD:
+        as_.alu(0x01, kWide, RAX, RCX);
+        overflow();
+        break;
+      case OpCode::SUB:
+        as_.alu(0x29, kWide, RCX, RAX);
+        overflow();
+        as_.alu(0x89, kWide, RAX, RCX);
+        break;
+      case OpCode::MUL:
+        as_.imul(kWide, RAX, RCX);
+        overflow();
+        break;
+      default: {
+        as_.alu(0x85, kWide, RAX, RAX);
+        fail(as_.jcc(E), ErrorCode::DIVIDE_BY_ZERO);
+        // 除以 -1 按取反处理，避免最小值除以 -1 触发硬件异常
+        as_.aluImm8(7, kWide, RAX, -1);
+        size_t divide = as_.jcc(NE);
+        as_.unary(3, kWide, RCX);
+        overflow();
+        as_.alu(0x89, kWide, RAX, RCX);
+        size_t done = as_.jmp();
+        as_.bind(divide);
+        as_.alu(0x87, kWide, RCX, RAX);
+        as_.signExtend(kWide);
+        as_.unary(7, kWide, RCX);
+        as_.bind(done);
+        break;
+      }
+    }
+  }
+
+  // 回绕策略下不检查
+  void overflow() {
+    if (kChecked) {
+      fail(as_.jcc(O), ErrorCode::INTEGER_OVERFLOW);
+    }
+  }
+
+  void store(int32_t slot) {
+    if (kWide) {
+      as_.movsxd(RCX, RAX);
+      as_.alu(0x39, true, RCX, RAX);
+      fail(as_.jcc(NE), ErrorCode::INTEGER_OVERFLOW);
+    }
+    as_.cmpMemImm8(RBX, offsetof(JitFrame, scopes), 0);
+    size_t scoped = as_.jcc(NE);
+    as_.store(false, R12, slot * 4, RAX);
+    as_.bitOp(5, R13, (slot >> 6) * 8, slot & 63);
+    size_t resume = as_.size();
+    // 作用域中的赋值要记录被遮蔽的绑定，交给 VarState
+    cold_.push_back([this, scoped, resume, slot] {
+      as_.bind(scoped);
+      as_.movImm(false, RSI, slot);
+      as_.alu(0x89, false, RDX, RAX);
+      call(reinterpret_cast<void*>(&jitStore));
+      as_.patch(as_.jmp(), resume);
+    });
+  }
+
+  const Bytecode& bytecode_;
+  const std::vector<int32_t>& owner_;
+  bool budgeted_;
+  Assembler as_;
+  // 本块中各字节码偏移对应的本机代码位置
+  std::unordered_map<int32_t, size_t> native_;
+  std::unordered_map<int32_t, size_t> stubs_;
+  std::vector<int32_t> pending_;
+  std::vector<std::pair<size_t, int32_t>> jumps_;
+  std::vector<size_t> exits_;
+  std::vector<std::function<void()>> cold_;
+  std::vector<std::pair<int32_t, int32_t>> words_;
+  std::vector<std::pair<int32_t, size_t>> entries_;
+  std::vector<int32_t> targets_;
+  int32_t covered_{0};
+  int slots_{0};
+};
+
+#endif
+
+}  // namespace
+
+JitCode::~JitCode() {
+#ifdef BASIC_JIT_X86_64
+  for (const Chunk& chunk : chunks_) {
+    munmap(chunk.memory, chunk.size);
+  }
+#endif
+}
+
+JitExit JitCode::run(VarState& state, Output& out, VMContext& context,
+                     uint64_t& budget) const {
+#ifdef BASIC_JIT_X86_64
+  bool budgeted = budget != VM::kUnlimited;
+  const Tier& tier = tiers_[budgeted];
+  if (static_cast<size_t>(context.ip) >= tier.table.size()) {
+    return JitExit::MISS;
+  }
+  state.reserve(slots_);
+  JitFrame frame{state.values(),
+                 state.definedBits(),
+                 &state,
+                 &out,
+                 tier.table.data(),
+                 budget,
+                 nullptr,
+                 static_cast<int32_t>(state.scopeDepth()),
+                 0,
+                 0,
+                 context.ip,
+                 static_cast<int32_t>(JitExit::HALT),
+                 context.suspendInput ? 1 : 0};
+  reinterpret_cast<void (*)(JitFrame*)>(entry_)(&frame);
+  auto exit = static_cast<JitExit>(frame.exit);
+  context.ip = frame.ip;
+  if (budgeted) {
+    budget = frame.budget;
+  }
+  if (exit == JitExit::INPUT) {
+    context.inputSlot = frame.payload;
+  } else if (exit == JitExit::ERROR) {
+    context.fault.raise(static_cast<ErrorCode>(frame.error), frame.payload);
+  }
+  return exit;
+#else
+  (void)state;
+  (void)out;
+  (void)context;
+  (void)budget;
+  return JitExit::MISS;
+#endif
+}
+
+bool JitCode::translate(const Bytecode& bytecode, int32_t pc, bool budgeted) {
+#ifdef BASIC_JIT_X86_64
+  // 跳转表的位移为 pc * 8，须在 32 位以内
+  if (bytecode.code.size() >= (1u << 28)) {
+    return false;
+  }
+  grow(bytecode);
+  Tier& tier = tiers_[budgeted];
+  if (pc < 0 || static_cast<size_t>(pc) >= tier.table.size()) {
+    return false;
+  }
+  if (tier.table[pc] != miss_) {
+    return true;
+  }
+  if (tier.owner[pc] >= 0) {
+    return false;  // 不在语句边界上
+  }
+  Translator translator(bytecode, tier.owner, budgeted);
+  if (!translator.translate(pc)) {
+    return false;
+  }
+  uint8_t* base = place(translator.code());
+  if (base == nullptr) {
+    return false;
+  }
+  auto id = static_cast<int32_t>(blocks_.size());
+  Block& block = blocks_.emplace_back();
+  block.words = translator.words();
+  block.targets = translator.targets();
+  block.bytes = translator.code().size();
+  block.budgeted = budgeted;
+  for (auto [first, last] : block.words) {
+    std::fill(tier.owner.begin() + first, tier.owner.begin() + last, id);
+  }
+  for (auto [at, offset] : translator.entries()) {
+    tier.table[at] = reinterpret_cast<uintptr_t>(base + offset);
+  }
+  liveBytes_ += block.bytes;
+  slots_ = std::max(slots_, translator.slots());
+  return true;
+#else
+  (void)bytecode;
+  (void)pc;
+  (void)budgeted;
+  return false;
+#endif
+}
+
+void JitCode::translateReachable(const Bytecode& bytecode) {
+  grow(bytecode);
+  const Tier& tier = tiers_[0];
+  std::vector<bool> seen(tier.table.size());
+  std::vector<bool> visited;
+  std::vector<int32_t> pending{bytecode.entry};
+  while (!pending.empty()) {
+    int32_t pc = pending.back();
+    pending.pop_back();
+    if (pc < 0 || static_cast<size_t>(pc) >= seen.size() || seen[pc]) {
+      continue;
+    }
+    seen[pc] = true;
+    if (!translate(bytecode, pc, false)) {
+      continue;  // 执行到这里时由 VM 接着执行
+    }
+    auto id = static_cast<size_t>(tier.owner[pc]);
+    visited.resize(blocks_.size());
+    if (!visited[id]) {
+      visited[id] = true;
+      const std::vector<int32_t>& targets = blocks_[id].targets;
+      pending.insert(pending.end(), targets.begin(), targets.end());
+    }
+  }
+}
+
+void JitCode::invalidate(const Bytecode& bytecode) {
+  grow(bytecode);
+  for (int32_t at : bytecode.patched) {
+    for (const Tier& tier : tiers_) {
+      if (tier.owner[at] >= 0) {
+        discard(tier.owner[at]);
+      }
+    }
+  }
+}
+
+bool JitCode::wasteful() const noexcept {
+  return deadBytes_ > kChunkSize && deadBytes_ > liveBytes_;
+}
+
+void JitCode::discard(int32_t id) {
+  Block& block = blocks_[id];
+  Tier& tier = tiers_[block.budgeted];
+  for (auto [first, last] : block.words) {
+    std::fill(tier.owner.begin() + first, tier.owner.begin() + last, -1);
+    std::fill(tier.table.begin() + first, tier.table.begin() + last, miss_);
+  }
+  liveBytes_ -= block.bytes;
+  deadBytes_ += block.bytes;
+  block = Block{};
+}
+
+void JitCode::grow(const Bytecode& bytecode) {
+  size_t size = bytecode.code.size();
+  for (Tier& tier : tiers_) {
+    if (tier.table.size() < size) {
+      tier.table.resize(size, miss_);
+      tier.owner.resize(size, -1);
+    }
+  }
+}
+
+uint8_t* JitCode::place(const std::vector<uint8_t>& code) {
+#ifdef BASIC_JIT_X86_64
+  size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  if (chunks_.empty() ||
+      chunks_.back().size - chunks_.back().used < code.size()) {
+    size_t size = std::max(kChunkSize, (code.size() + page - 1) / page * page);
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_EXEC,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+      return nullptr;
+    }
+    chunks_.push_back({static_cast<uint8_t*>(memory), size, 0});
+  }
+  Chunk& chunk = chunks_.back();
+  uint8_t* at = chunk.memory + chunk.used;
+  // 只有写入的几页临时可写，其余代码保持只读可执行
+  size_t first = chunk.used / page * page;
+  size_t last = (chunk.used + code.size() + page - 1) / page * page;
+  if (mprotect(chunk.memory + first, last - first, PROT_READ | PROT_WRITE) !=
+      0) {
+    return nullptr;
+  }
+  std::memcpy(at, code.data(), code.size());
+  if (mprotect(chunk.memory + first, last - first, PROT_READ | PROT_EXEC) !=
+      0) {
+    return nullptr;
+  }
+  chunk.used += (code.size() + 15) / 16 * 16;
+  return at;
+#else
+  (void)code;
+  return nullptr;
+#endif
+}
+
+bool Jit::supported() noexcept {
+#ifdef BASIC_JIT_X86_64
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::unique_ptr<JitCode> Jit::compile(const Bytecode& bytecode) const {
+#ifdef BASIC_JIT_X86_64
+  std::unique_ptr<JitCode> code(new JitCode());
+  Assembler as;
+  prologue(as);
+  // MISS 出口：转移处已把目标偏移放在 ecx 中
+  size_t miss = as.size();
+  as.store(false, RBX, offsetof(JitFrame, ip), RCX);
+  as.storeImm(RBX, offsetof(JitFrame, exit),
+              static_cast<int32_t>(JitExit::MISS));
+  epilogue(as);
+  uint8_t* base = code->place(as.code());
+  if (base == nullptr) {
+    return nullptr;
+  }
+  code->entry_ = base;
+  code->miss_ = reinterpret_cast<uintptr_t>(base + miss);
+  code->grow(bytecode);
+  return code;
+#else
+  (void)bytecode;
+  return nullptr;
+#endif
+}
@@ -2,19 +2,27 @@
 
 #include <limits>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "utils/Error.hpp"
 
-const std::unordered_map<std::string, TokenType> TABLE = {
-    {"LET", TokenType::LET},     {"PRINT", TokenType::PRINT},
-    {"INPUT", TokenType::INPUT}, {"END", TokenType::END},
-    {"REM", TokenType::REM},     {"GOTO", TokenType::GOTO},
-    {"IF", TokenType::IF},       {"THEN", TokenType::THEN},
-    {"RUN", TokenType::RUN},     {"LIST", TokenType::LIST},
-    {"CLEAR", TokenType::CLEAR}, {"QUIT", TokenType::QUIT},
-    {"HELP", TokenType::HELP}};
+static_assert(Lexer::matchKeyword("LET") == TokenType::LET);
+static_assert(Lexer::matchKeyword("PRINT") == TokenType::PRINT);
+static_assert(Lexer::matchKeyword("INPUT") == TokenType::INPUT);
+static_assert(Lexer::matchKeyword("END") == TokenType::END);
+static_assert(Lexer::matchKeyword("REM") == TokenType::REM);
+static_assert(Lexer::matchKeyword("GOTO") == TokenType::GOTO);
+static_assert(Lexer::matchKeyword("IF") == TokenType::IF);
+static_assert(Lexer::matchKeyword("THEN") == TokenType::THEN);
+static_assert(Lexer::matchKeyword("RUN") == TokenType::RUN);
+static_assert(Lexer::matchKeyword("LIST") == TokenType::LIST);
+static_assert(Lexer::matchKeyword("CLEAR") == TokenType::CLEAR);
+static_assert(Lexer::matchKeyword("QUIT") == TokenType::QUIT);
+static_assert(Lexer::matchKeyword("HELP") == TokenType::HELP);
+static_assert(Lexer::matchKeyword("INDENT") == TokenType::INDENT);
+static_assert(Lexer::matchKeyword("DEDENT") == TokenType::DEDENT);
+static_assert(Lexer::matchKeyword("LETX") == TokenType::UNKNOWN);
+static_assert(Lexer::matchKeyword("let") == TokenType::UNKNOWN);
 
 bool isOverflow(const std::string& digits, bool negative) {
   constexpr long long max_limit = std::numeric_limits<int>::max();
@@ -22,7 +30,7 @@ bool isOverflow(const std::string& digits, bool negative) {
                   : std::stol(digits) > max_limit + 1;
 }
 
-TokenStream Lexer::tokenize(const std::string& line) const {
+TokenStream Lexer::tokenize(std::string_view line) const {
   std::vector<Token> tokens;
   int column = 0;
   while (column < line.size()) {
@@ -38,13 +46,13 @@ TokenStream Lexer::tokenize(const std::string& line) const {
       while (column < line.size() && isLetterChar(line[column])) {
         ++column;
       }
-      std::string text = line.substr(start, column - start);
+      std::string_view text = line.substr(start, column - start);
       TokenType type = matchKeyword(text);
       switch (type) {
         case TokenType::REM:
           tokens.push_back(Token{TokenType::REM, text, column});
           if (column < line.size()) {
-            std::string comment = line.substr(column);
+            std::string_view comment = line.substr(column);
             tokens.push_back(Token{TokenType::REMINFO, comment, column + 1});
           }
           return TokenStream(std::move(tokens));
@@ -62,7 +70,7 @@ TokenStream Lexer::tokenize(const std::string& line) const {
       while (column < line.size() && isNumberChar(line[column])) {
         ++column;
       }
-      std::string text = line.substr(start, column - start);
+      std::string_view text = line.substr(start, column - start);
       tokens.push_back(Token{TokenType::NUMBER, text, column});
       continue;
     }
@@ -103,7 +111,7 @@ TokenStream Lexer::tokenize(const std::string& line) const {
         break;
     }
     if (symbolType != TokenType::UNKNOWN) {
-      tokens.push_back(Token{symbolType, std::string(1, ch), column});
+      tokens.push_back(Token{symbolType, line.substr(column, 1), column});
       ++column;
       continue;
     }
@@ -120,12 +128,4 @@ bool Lexer::isLetterChar(char ch) noexcept {
 
 bool Lexer::isNumberChar(char ch) noexcept {
   return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_';
-}
-
-TokenType Lexer::matchKeyword(const std::string& text) noexcept {
-  auto it = TABLE.find(text);
-  if (it != TABLE.end()) {
-    return it->second;
-  }
-  return TokenType::UNKNOWN;
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Loader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "utils/Error.hpp"
+
+MappedFile::MappedFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw BasicError("CANNOT OPEN FILE");
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    ::close(fd);
+    throw BasicError("CANNOT OPEN FILE");
+  }
+  size_ = static_cast<size_t>(info.st_size);
+  // 空文件无法映射，直接视为没有内容
+  if (size_ > 0) {
+    void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      throw BasicError("CANNOT OPEN FILE");
+    }
+    ::madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(data);
+  }
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+Loader::Loader(const Parser& prototype, CommandFilter isCommand,
+               unsigned threads)
+    : prototype_(prototype),
+      isCommand_(isCommand),
+      threads_(threads != 0 ? threads : std::thread::hardware_concurrency()) {}
+
+std::vector<std::string_view> Loader::splitLines(std::string_view source) {
+  std::vector<std::string_view> lines;
+  lines.reserve(std::count(source.begin(), source.end(), '\n') + 1);
+  size_t start = 0;
+  while (start < source.size()) {
+    size_t end = source.find('\n', start);
+    if (end == std::string_view::npos) {
+      end = source.size();
+    }
+    lines.push_back(source.substr(start, end - start));
+    start = end + 1;
+  }
+  return lines;
+}
+
+std::vector<LoadedLine> Loader::parse(std::string_view source) const {
+  std::vector<std::string_view> lines = splitLines(source);
+  std::vector<LoadedLine> results(lines.size());
+
+  size_t chunks = (lines.size() + kChunkLines - 1) / kChunkLines;
+  size_t workers = std::min<size_t>(chunks, std::max(1u, threads_));
+  if (workers <= 1) {
+    parseRange(lines, results, 0, lines.size(), prototype_);
+    return results;
+  }
+
+  // 各线程按块领取行区间，结果写入各自下标，互不重叠
+  std::atomic<size_t> nextChunk{0};
+  auto work = [&]() {
+    Parser parser = prototype_;
+    for (size_t chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+      size_t begin = chunk * kChunkLines;
+      size_t end = std::min(begin + kChunkLines, lines.size());
+      parseRange(lines, results, begin, end, parser);
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(workers - 1);
+  for (size_t i = 1; i < workers; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
+void Loader::parseRange(const std::vector<std::string_view>& lines,
+                        std::vector<LoadedLine>& results, size_t begin,
+                        size_t end, const Parser& parser) const {
+  for (size_t i = begin; i < end; ++i) {
+    LoadedLine& result = results[i];
+    result.text = lines[i];
+    if (isCommand_(lines[i])) {
+      result.kind = LoadedLine::Kind::COMMAND;
+      continue;
+    }
+    try {
+      TokenStream tokens = lexer_.tokenize(lines[i]);
+      if (tokens.empty()) {
+        continue;
+      }
+      ParsedLine parsed = parser.parseLine(tokens, lines[i]);
+      result.kind = LoadedLine::Kind::PARSED;
+      result.line = parsed.getLine();
+      result.stmt.reset(parsed.fetchStatement());
+    } catch (const BasicError& e) {
+      result.kind = LoadedLine::Kind::ERROR;
+      result.error = e.message();
+    }
+  }
+}
@@ -0,0 +1,233 @@
+#include "Loop.hpp"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Arith.hpp"
+#include "Expression.hpp"
+#include "Statement.hpp"
+#include "VarState.hpp"
+
+namespace {
+
+bool isVariable(const Expression* expr, int slot) {
+  return expr->kind() == ExprKind::VARIABLE &&
+         static_cast<const VariableExpression*>(expr)->slot() == slot;
+}
+
+bool isConst(const Expression* expr) {
+  return expr->kind() == ExprKind::CONST;
+}
+
+int valueOf(const Expression* expr) {
+  return static_cast<const ConstExpression*>(expr)->value();
+}
+
+// 表达式中是否读取 slot
+bool reads(const Expression* expr, int slot) {
+  std::vector<const Expression*> pending{expr};
+  while (!pending.empty()) {
+    const Expression* node = pending.back();
+    pending.pop_back();
+    if (node->kind() == ExprKind::COMPOUND) {
+      auto* compound = static_cast<const CompoundExpression*>(node);
+      pending.push_back(compound->left());
+      pending.push_back(compound->right());
+    } else if (isVariable(node, slot)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// LET X = X + c / c + X / X - c 中的 c，不是这种形状时返回 false
+bool addend(const Expression* expr, int slot, int& value) {
+  if (expr->kind() != ExprKind::COMPOUND) {
+    return false;
+  }
+  auto* compound = static_cast<const CompoundExpression*>(expr);
+  const Expression* lhs = compound->left();
+  const Expression* rhs = compound->right();
+  if (compound->op() == '+' && isConst(lhs)) {
+    std::swap(lhs, rhs);
+  }
+  if (!isVariable(lhs, slot) || !isConst(rhs)) {
+    return false;
+  }
+  value = valueOf(rhs);
+  if (compound->op() == '+') {
+    return true;
+  }
+  // INT_MIN 取反会溢出
+  if (compound->op() == '-' && value != std::numeric_limits<int>::min()) {
+    value = -value;
+    return true;
+  }
+  return false;
+}
+
+// LET X = X + I / I + X
+bool addsCounter(const Expression* expr, int slot, int counter) {
+  if (expr->kind() != ExprKind::COMPOUND) {
+    return false;
+  }
+  auto* compound = static_cast<const CompoundExpression*>(expr);
+  const Expression* lhs = compound->left();
+  const Expression* rhs = compound->right();
+  return compound->op() == '+' &&
+         ((isVariable(lhs, slot) && isVariable(rhs, counter)) ||
+          (isVariable(lhs, counter) && isVariable(rhs, slot)));
+}
+
+}  // namespace
+
+bool CountedLoop::match(const std::vector<ExecLine>& plan, int tail,
+                        CountedLoop& loop) {
+  const ExecLine& branch = plan[tail];
+  if (branch.kind != StmtKind::IF || branch.target < 0) {
+    return false;
+  }
+  // 条件：I < N 或 N > I
+  auto* condition = static_cast<const IfStatement*>(branch.stmt);
+  const Expression* counter = condition->left();
+  const Expression* limit = condition->right();
+  if (condition->op() == '>') {
+    std::swap(counter, limit);
+  } else if (condition->op() != '<') {
+    return false;
+  }
+  if (counter->kind() != ExprKind::VARIABLE) {
+    return false;
+  }
+  loop.head = branch.target;
+  loop.tail = tail;
+  loop.counter = static_cast<const VariableExpression*>(counter)->slot();
+  loop.limitSlot = -1;
+  loop.limit = 0;
+  if (isConst(limit)) {
+    loop.limit = valueOf(limit);
+  } else if (limit->kind() == ExprKind::VARIABLE &&
+             !isVariable(limit, loop.counter)) {
+    loop.limitSlot = static_cast<const VariableExpression*>(limit)->slot();
+  } else {
+    return false;
+  }
+
+  // 从首行沿 next 经过的 LET 回到末行，最后一条是递增
+  loop.increment = -1;
+  loop.length = 1;
+  for (int slot = loop.head; slot != tail; slot = plan[slot].next) {
+    if (slot < 0 || plan[slot].kind != StmtKind::LET ||
+        loop.length == kMaxLength) {
+      return false;
+    }
+    loop.increment = slot;
+    ++loop.length;
+  }
+  if (loop.increment < 0) {
+    return false;
+  }
+
+  // 递增：LET I = I + c，c > 0
+  auto* let = static_cast<const LetStatement*>(plan[loop.increment].stmt);
+  if (let->varSlot() != loop.counter ||
+      !addend(let->expression(), loop.counter, loop.step) || loop.step <= 0) {
+    return false;
+  }
+
+  // 循环体：顺序执行的 LET，不写计数器与上界
+  loop.readsCounter = false;
+  loop.closed = true;
+  loop.steps.clear();
+  for (int i = loop.head; i != loop.increment; i = plan[i].next) {
+    const ExecLine& entry = plan[i];
+    auto* body = static_cast<const LetStatement*>(entry.stmt);
+    int slot = body->varSlot();
+    if (slot == loop.counter || slot == loop.limitSlot) {
+      return false;
+    }
+    const Expression* expr = body->expression();
+    loop.readsCounter = loop.readsCounter || reads(expr, loop.counter);
+    if (!loop.closed) {
+      continue;
+    }
+    // 每个变量只能由一条语句更新，各条累加之间才互不影响
+    for (const Step& step : loop.steps) {
+      loop.closed = loop.closed && step.slot != slot;
+    }
+    int value = 0;
+    if (isConst(expr)) {
+      loop.steps.push_back(Step{Update::ASSIGN, slot, valueOf(expr)});
+    } else if (addend(expr, slot, value)) {
+      loop.steps.push_back(Step{Update::ADD_CONST, slot, value});
+    } else if (addsCounter(expr, slot, loop.counter)) {
+      loop.steps.push_back(Step{Update::ADD_COUNTER, slot, 0});
+    } else {
+      loop.closed = false;
+    }
+  }
+  if (!loop.closed) {
+    loop.steps.clear();
+  }
+  return true;
+}
+
+uint64_t CountedLoop::evaluate(VarState& state, uint64_t maxRounds) const {
+  using Wide = __int128;
+  if (!closed || !state.isDefined(counter) ||
+      (limitSlot >= 0 && !state.isDefined(limitSlot))) {
+    return 0;
+  }
+  Wide first = state.peek(counter);
+  Wide bound = limitSlot >= 0 ? state.peek(limitSlot) : limit;
+  // 至少执行一轮；此后 I 第一次不小于 N 时离开
+  Wide rounds = first + step >= bound ? 1 : (bound - first + step - 1) / step;
+  Wide last = first + rounds * step;
+  if (rounds > static_cast<Wide>(maxRounds) ||
+      last > std::numeric_limits<int>::max()) {
+    return 0;
+  }
+
+  // 精确算出各变量的结果；回绕时取低 32 位，否则须在 32 位范围内。
+  // 各条累加的中间值单调，结果在范围内即途中不会溢出
+  auto result = [&](const Step& step, int& out) {
+    Wide value = step.value;
+    if (step.update != Update::ASSIGN) {
+      if (!state.isDefined(step.slot)) {
+        return false;
+      }
+      value = state.peek(step.slot);
+    }
+    if (step.update == Update::ADD_CONST) {
+      value += rounds * step.value;
+    } else if (step.update == Update::ADD_COUNTER) {
+      if (arith::kPolicy != arith::Policy::WRAP && first < 0) {
+        return false;  // 计数器由负转正时中间值不单调
+      }
+      value += rounds * first + this->step * (rounds * (rounds - 1) / 2);
+    }
+    if constexpr (arith::kPolicy == arith::Policy::WRAP) {
+      out = static_cast<int>(static_cast<uint32_t>(value));
+      return true;
+    }
+    if (value < std::numeric_limits<int>::min() ||
+        value > std::numeric_limits<int>::max()) {
+      return false;
+    }
+    out = static_cast<int>(value);
+    return true;
+  };
+  int out = 0;
+  for (const Step& step : steps) {
+    if (!result(step, out)) {
+      return 0;
+    }
+  }
+  for (const Step& step : steps) {
+    result(step, out);
+    state.setValue(step.slot, out);
+  }
+  state.setValue(counter, static_cast<int>(last));
+  return static_cast<uint64_t>(rounds);
+}
@@ -0,0 +1,99 @@
+#include "Optimizer.hpp"
+
+#include <limits>
+
+#include "Arena.hpp"
+#include "Expression.hpp"
+
+// 后序遍历用显式栈完成：子树化简的结果依次压入 folded，
+// 处理运算节点时弹出左右两个结果
+Expression* Optimizer::fold(Expression* expr, Arena& arena) const {
+  if (expr->kind() != ExprKind::COMPOUND) {
+    return expr;
+  }
+  std::vector<std::pair<Expression*, bool>>& pending = pending_;
+  std::vector<Expression*>& folded = folded_;
+  pending.assign(1, {expr, false});
+  folded.clear();
+  while (!pending.empty()) {
+    auto [node, expanded] = pending.back();
+    pending.pop_back();
+    if (node->kind() != ExprKind::COMPOUND) {
+      folded.push_back(node);
+      continue;
+    }
+    auto* compound = static_cast<CompoundExpression*>(node);
+    if (!expanded) {
+      pending.emplace_back(node, true);
+      pending.emplace_back(compound->right_, false);
+      pending.emplace_back(compound->left_, false);
+      continue;
+    }
+    Expression* right = folded.back();
+    folded.pop_back();
+    Expression* left = folded.back();
+    folded.back() = simplify(compound, left, right, arena);
+  }
+  return folded.back();
+}
+
+// left、right 为已化简的子树
+Expression* Optimizer::simplify(CompoundExpression* compound, Expression* left,
+                                Expression* right, Arena& arena) {
+  char op = compound->op_;
+  // 子树有变化时重新创建节点，使特化的操作数种类与新的子节点一致
+  auto rebuilt = [&]() -> Expression* {
+    if (left == compound->left_ && right == compound->right_) {
+      return compound;
+    }
+    return makeCompound(arena, left, op, right);
+  };
+
+  // 两侧均为常量：运行期一定得到同一结果时才折叠
+  if (left->kind() == ExprKind::CONST && right->kind() == ExprKind::CONST) {
+    int result;
+    if (foldConstant(op, static_cast<ConstExpression*>(left)->value(),
+                     static_cast<ConstExpression*>(right)->value(), result)) {
+      return arena.make<ConstExpression>(result);
+    }
+    return rebuilt();
+  }
+
+  // 恒等式 x*1、x/1、x+0、x-0、1*x、0+x：保留 x 本身，错误语义不变
+  Expression* kept = nullptr;
+  if (isConst(right, 1) && (op == '*' || op == '/')) {
+    kept = left;
+  } else if (isConst(right, 0) && (op == '+' || op == '-')) {
+    kept = left;
+  } else if (isConst(left, 1) && op == '*') {
+    kept = right;
+  } else if (isConst(left, 0) && op == '+') {
+    kept = right;
+  }
+  return kept != nullptr ? kept : rebuilt();
+}
+
+bool Optimizer::isConst(const Expression* expr, int value) noexcept {
+  return expr->kind() == ExprKind::CONST &&
+         static_cast<const ConstExpression*>(expr)->value() == value;
+}
+
+bool Optimizer::foldConstant(char op, int lhs, int rhs, int& result) noexcept {
+  switch (op) {
+    case '+':
+      return !__builtin_add_overflow(lhs, rhs, &result);
+    case '-':
+      return !__builtin_sub_overflow(lhs, rhs, &result);
+    case '*':
+      return !__builtin_mul_overflow(lhs, rhs, &result);
+    case '/':
+      // 除以 0 必须在执行时报 DIVIDE BY ZERO
+      if (rhs == 0 || (lhs == std::numeric_limits<int>::min() && rhs == -1)) {
+        return false;
+      }
+      result = lhs / rhs;
+      return true;
+    default:
+      return false;
+  }
+}
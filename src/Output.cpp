@@ -0,0 +1,88 @@
+#include "Output.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+
+Output::Output(int fd, size_t capacity)
+    : fd_(fd),
+      mode_(isatty(fd) ? Mode::LINE : Mode::FULL),
+      buffer_(capacity) {}
+
+Output::~Output() { flush(); }
+
+Output& Output::operator<<(std::string_view text) {
+  append(text.data(), text.size());
+  if (mode_ == Mode::LINE &&
+      std::memchr(text.data(), '\n', text.size()) != nullptr) {
+    flush();
+  }
+  return *this;
+}
+
+Output& Output::operator<<(char ch) {
+  append(&ch, 1);
+  if (mode_ == Mode::LINE && ch == '\n') {
+    flush();
+  }
+  return *this;
+}
+
+Output& Output::operator<<(int value) {
+  char digits[16];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  append(digits, result.ptr - digits);
+  return *this;
+}
+
+Output& Output::operator<<(int64_t value) {
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  append(digits, result.ptr - digits);
+  return *this;
+}
+
+void Output::flush() {
+  writeAll(buffer_.data(), size_);
+  size_ = 0;
+}
+
+void Output::append(const char* data, size_t size) {
+  if (size_ + size > buffer_.size()) {
+    flush();
+    // 超过整个缓冲区的内容直接写出
+    if (size > buffer_.size()) {
+      writeAll(data, size);
+      return;
+    }
+  }
+  std::memcpy(buffer_.data() + size_, data, size);
+  size_ += size;
+}
+
+void Output::captureTo(std::string* sink) noexcept {
+  flush();
+  sink_ = sink;
+  mode_ = Mode::FULL;
+}
+
+void Output::writeAll(const char* data, size_t size) {
+  if (sink_ != nullptr) {
+    sink_->append(data, size);
+    return;
+  }
+  while (size > 0) {
+    ssize_t written = ::write(fd_, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // 输出端已关闭，丢弃剩余内容
+      return;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+}
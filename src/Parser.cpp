@@ -1,12 +1,15 @@
 #include "Parser.hpp"
 
+#include <charconv>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "Expression.hpp"
+#include "Optimizer.hpp"
 #include "Statement.hpp"
+#include "SymbolTable.hpp"
 #include "utils/Error.hpp"
 
 ParsedLine::ParsedLine() { statement_ = nullptr; }
@@ -28,7 +31,7 @@ Statement* ParsedLine::fetchStatement() {
 }
 
 ParsedLine Parser::parseLine(TokenStream& tokens,
-                             const std::string& originLine) const {
+                             std::string_view originLine) const {
   ParsedLine result;
 
   // 检查是否有行号
@@ -44,14 +47,21 @@ ParsedLine Parser::parseLine(TokenStream& tokens,
     }
   }
 
+  // 本行的源码与表达式节点都分配在同一个 Arena 中，解析失败时随之释放
+  Arena arena(kArenaBase + originLine.size() + kArenaPerToken * tokens.size());
+  arena_ = &arena;
+  std::string_view source = arena.copy(originLine);
+
   // 解析语句
-  result.setStatement(parseStatement(tokens, originLine));
+  Statement* stmt = parseStatement(tokens, source);
+  stmt->adoptArena(std::move(arena));
+  result.setStatement(stmt);
 
   return result;
 }
 
 Statement* Parser::parseStatement(TokenStream& tokens,
-                                  const std::string& originLine) const {
+                                  std::string_view originLine) const {
   if (tokens.empty()) {
     throw BasicError("SYNTAX ERROR");
   }
@@ -76,13 +86,17 @@ Statement* Parser::parseStatement(TokenStream& tokens,
       return parseRem(tokens, originLine);
     case TokenType::END:
       return parseEnd(tokens, originLine);
+    case TokenType::INDENT:
+      return parseIndent(tokens, originLine);
+    case TokenType::DEDENT:
+      return parseDedent(tokens, originLine);
     default:
       throw BasicError("SYNTAX ERROR");
   }
 }
 
 Statement* Parser::parseLet(TokenStream& tokens,
-                            const std::string& originLine) const {
+                            std::string_view originLine) const {
   if (tokens.empty()) {
     throw BasicError("SYNTAX ERROR");
   }
@@ -92,7 +106,7 @@ Statement* Parser::parseLet(TokenStream& tokens,
     throw BasicError("SYNTAX ERROR");
   }
 
-  std::string varName = varToken->text;
+  int varSlot = symbols_->intern(varToken->text);
 
   if (tokens.empty() || tokens.get()->type != TokenType::EQUAL) {
     throw BasicError("SYNTAX ERROR");
@@ -101,18 +115,18 @@ Statement* Parser::parseLet(TokenStream& tokens,
   auto expr = parseExpression(tokens);
 
   // TODO: create a corresponding stmt and return it.
-  return new LetStatement(originLine,varName, expr);
+  return LetStatement::create(originLine, varSlot, expr, fuse_);
 }
 
 Statement* Parser::parsePrint(TokenStream& tokens,
-                              const std::string& originLine) const {
+                              std::string_view originLine) const {
   auto expr = parseExpression(tokens);
   // TODO: create a corresponding stmt and return it.
   return new PrintStatement(originLine, expr);
 }
 
 Statement* Parser::parseInput(TokenStream& tokens,
-                              const std::string& originLine) const {
+                              std::string_view originLine) const {
   if (tokens.empty()) {
     throw BasicError("SYNTAX ERROR");
   }
@@ -122,13 +136,13 @@ Statement* Parser::parseInput(TokenStream& tokens,
     throw BasicError("SYNTAX ERROR");
   }
 
-  std::string varName = varToken->text;
+  int varSlot = symbols_->intern(varToken->text);
   // TODO: create a corresponding stmt and return it.
-  return new InputStatement(originLine, varName);
+  return new InputStatement(originLine, varSlot);
 }
 
 Statement* Parser::parseGoto(TokenStream& tokens,
-                             const std::string& originLine) const {
+                             std::string_view originLine) const {
   if (tokens.empty()) {
     throw BasicError("SYNTAX ERROR");
   }
@@ -144,7 +158,7 @@ Statement* Parser::parseGoto(TokenStream& tokens,
 }
 
 Statement* Parser::parseIf(TokenStream& tokens,
-                           const std::string& originLine) const {
+                           std::string_view originLine) const {
   // 解析左表达式
   auto leftExpr = parseExpression(tokens);
 
@@ -190,11 +204,12 @@ Statement* Parser::parseIf(TokenStream& tokens,
   int targetLine = parseLiteral(lineToken);
 
   // TODO: create a corresponding stmt and return it.
-  return new IfStatement(originLine, leftExpr, op, rightExpr, targetLine);
+  return IfStatement::create(originLine, leftExpr, op, rightExpr, targetLine,
+                             fuse_);
 }
 
 Statement* Parser::parseRem(TokenStream& tokens,
-                            const std::string& originLine) const {
+                            std::string_view originLine) const {
   const Token* remInfo = tokens.get();
   if (!remInfo || remInfo->type != TokenType::REMINFO) {
     throw BasicError("SYNTAX ERROR");
@@ -204,92 +219,122 @@ Statement* Parser::parseRem(TokenStream& tokens,
 }
 
 Statement* Parser::parseEnd(TokenStream& tokens,
-                            const std::string& originLine) const {
+                            std::string_view originLine) const {
   // TODO: create a corresponding stmt and return it.
   return new EndStatement(originLine);
 }
 
-Expression* Parser::parseExpression(TokenStream& tokens) const {
-  return parseExpression(tokens, 0);
+// INDENT/DEDENT 与 END 一样忽略其后的多余内容
+Statement* Parser::parseIndent(TokenStream& tokens,
+                               std::string_view originLine) const {
+  return new IndentStatement(originLine);
 }
 
-Expression* Parser::parseExpression(TokenStream& tokens, int precedence) const {
-  // 解析左操作数
-  Expression* left;
+Statement* Parser::parseDedent(TokenStream& tokens,
+                               std::string_view originLine) const {
+  return new DedentStatement(originLine);
+}
 
-  if (tokens.empty()) {
-    throw BasicError("SYNTAX ERROR");
-  }
+void Parser::setFolding(bool enabled) noexcept { fold_ = enabled; }
 
-  const Token* token = tokens.get();
-  if (!token) {
-    throw BasicError("SYNTAX ERROR");
-  }
+void Parser::setFusion(bool enabled) noexcept { fuse_ = enabled; }
 
-  if (token->type == TokenType::NUMBER) {
-    int value = parseLiteral(token);
-    left = new ConstExpression(value);
-  } else if (token->type == TokenType::IDENTIFIER) {
-    left = new VariableExpression(token->text);
-  } else if (token->type == TokenType::LEFT_PAREN) {
-    ++leftParentCount;
-    left = parseExpression(tokens, 0);
-
-    if (tokens.empty() || tokens.get()->type != TokenType::RIGHT_PAREN) {
-      throw BasicError("MISMATCHED PARENTHESIS");
-    }
-    --leftParentCount;
-  } else {
-    throw BasicError("SYNTAX ERROR");
+void Parser::setSymbols(SymbolTable& symbols) noexcept { symbols_ = &symbols; }
+
+Expression* Parser::parseExpression(TokenStream& tokens) const {
+  Expression* expr = parseInfix(tokens);
+  if (fold_) {
+    expr = optimizer_.fold(expr, *arena_);
   }
+  // 很深的树降为 RPN，求值时不再逐层递归
+  return RpnExpression::lowerIfDeep(expr, *arena_);
+}
 
-  // 检查是否有运算符
-  while (!tokens.empty()) {
-    const Token* opToken = tokens.peek();
-    if (!opToken) {
-      break;
+// 与递归的优先级爬升逐步对应：遇到左括号或可以结合的运算符时压栈并转去读
+// 下一个操作数（相当于递归调用），本层结束时弹栈（相当于返回）。
+// 报错的位置与种类和递归实现完全相同。
+Expression* Parser::parseInfix(TokenStream& tokens) const {
+  // 上一次解析可能在括号未闭合时报错退出，栈与括号计数都要从头开始
+  frames_.clear();
+  leftParentCount = 0;
+  int precedence = 0;
+  while (true) {
+    // 解析操作数
+    if (tokens.empty()) {
+      throw BasicError("SYNTAX ERROR");
     }
 
-    // 检查是否是右括号
-    if (opToken->type == TokenType::RIGHT_PAREN) {
-      if (leftParentCount == 0) {
-        throw BasicError("MISMATCHED PARENTHESIS");
-      }
-      break;
+    const Token* token = tokens.get();
+    if (!token) {
+      throw BasicError("SYNTAX ERROR");
     }
 
-    // 检查是否是运算符
-    int opPrecedence = getPrecedence(opToken->type);
-    if (opPrecedence == -1 || opPrecedence < precedence) {
-      break;
+    Expression* left;
+    if (token->type == TokenType::NUMBER) {
+      int value = parseLiteral(token);
+      left = arena_->make<ConstExpression>(value);
+    } else if (token->type == TokenType::IDENTIFIER) {
+      left = arena_->make<VariableExpression>(
+          symbols_->intern(token->text));
+    } else if (token->type == TokenType::LEFT_PAREN) {
+      ++leftParentCount;
+      frames_.push_back(Frame{nullptr, '(', precedence});
+      precedence = 0;
+      continue;
+    } else {
+      throw BasicError("SYNTAX ERROR");
     }
 
-    tokens.get();  // 消费运算符token
-
-    char op;
-    switch (opToken->type) {
-      case TokenType::PLUS:
-        op = '+';
-        break;
-      case TokenType::MINUS:
-        op = '-';
-        break;
-      case TokenType::MUL:
-        op = '*';
-        break;
-      case TokenType::DIV:
-        op = '/';
+    // 检查运算符：能结合时压栈并读取右操作数，否则结束本层并交还给外层
+    while (true) {
+      const Token* opToken = tokens.empty() ? nullptr : tokens.peek();
+      int opPrecedence = -1;
+      if (opToken) {
+        // 检查是否是右括号
+        if (opToken->type == TokenType::RIGHT_PAREN && leftParentCount == 0) {
+          throw BasicError("MISMATCHED PARENTHESIS");
+        }
+        opPrecedence = getPrecedence(opToken->type);
+      }
+      if (opPrecedence != -1 && opPrecedence >= precedence) {
+        tokens.get();  // 消费运算符token
+        frames_.push_back(Frame{left, operatorSymbol(opToken->type), precedence});
+        // 右操作数使用更高的优先级
+        precedence = opPrecedence + 1;
         break;
-      default:
-        throw BasicError("SYNTAX ERROR");
-    }
+      }
 
-    // 解析右操作数，使用更高的优先级
-    auto right = parseExpression(tokens, opPrecedence + 1);
-    left = new CompoundExpression(left, op, right);
+      if (frames_.empty()) {
+        return left;
+      }
+      Frame frame = frames_.back();
+      frames_.pop_back();
+      precedence = frame.precedence;
+      if (frame.op == '(') {
+        if (tokens.empty() || tokens.get()->type != TokenType::RIGHT_PAREN) {
+          throw BasicError("MISMATCHED PARENTHESIS");
+        }
+        --leftParentCount;
+      } else {
+        left = makeCompound(*arena_, frame.left, frame.op, left);
+      }
+    }
   }
+}
 
-  return left;
+char Parser::operatorSymbol(TokenType op) {
+  switch (op) {
+    case TokenType::PLUS:
+      return '+';
+    case TokenType::MINUS:
+      return '-';
+    case TokenType::MUL:
+      return '*';
+    case TokenType::DIV:
+      return '/';
+    default:
+      throw BasicError("SYNTAX ERROR");
+  }
 }
 
 int Parser::getPrecedence(TokenType op) const {
@@ -310,19 +355,16 @@ int Parser::parseLiteral(const Token* token) const {
     throw BasicError("SYNTAX ERROR");
   }
 
-  try {
-    size_t pos;
-    int value = std::stoi(token->text, &pos);
-
-    // 检查是否整个字符串都被解析
-    if (pos != token->text.length()) {
-      throw BasicError("INT LITERAL OVERFLOW");
-    }
-
-    return value;
-  } catch (const std::out_of_range&) {
-    throw BasicError("INT LITERAL OVERFLOW");
-  } catch (const std::invalid_argument&) {
+  const char* begin = token->text.data();
+  const char* end = begin + token->text.size();
+  int value = 0;
+  auto [ptr, ec] = std::from_chars(begin, end, value);
+  if (ec == std::errc::invalid_argument) {
     throw BasicError("SYNTAX ERROR");
   }
+  // 超出 int 范围，或整个字符串未被完整解析
+  if (ec == std::errc::result_out_of_range || ptr != end) {
+    throw BasicError("INT LITERAL OVERFLOW");
+  }
+  return value;
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "Profiler.hpp"
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BASIC_PROFILE_TSC 1
+#endif
+
+uint64_t Profiler::now() noexcept {
+#ifdef BASIC_PROFILE_TSC
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+const char* Profiler::unit() noexcept {
+#ifdef BASIC_PROFILE_TSC
+  return "CYCLES";
+#else
+  return "NS";
+#endif
+}
+
+LineProfile* Profiler::begin(size_t lines) {
+  run_.assign(lines, LineProfile{});
+  return run_.data();
+}
+
+void Profiler::end(const std::vector<ExecLine>& lines) {
+  for (size_t i = 0; i < run_.size() && i < lines.size(); ++i) {
+    const LineProfile& sample = run_[i];
+    if (sample.hits == 0) {
+      continue;
+    }
+    LineProfile& total = totals_[lines[i].line];
+    total.hits += sample.hits;
+    total.ticks += sample.ticks;
+    total.taken += sample.taken;
+    total.untaken += sample.untaken;
+  }
+  run_.clear();
+}
+
+void Profiler::reset() {
+  run_.clear();
+  totals_.clear();
+}
@@ -1,125 +1,713 @@
 // TODO: Imply interfaces declared in the Program.hpp.
 #include "Program.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "Arith.hpp"
+#include "Image.hpp"
+#include "Loader.hpp"
 #include "Recorder.hpp"
 #include "Statement.hpp"
+#include "SymbolTable.hpp"
+#include "VM.hpp"
 #include "VarState.hpp"
+#include "utils/Error.hpp"
+
+Program::Program(int outputFd)
+    : output_(outputFd),
+      programCounter_(0),
+      programEnd_(false),
+      jumped_(false),
+      base_(nullptr),
+      current_(nullptr),
+      nextIndex_(-1),
+      engine_(Engine::TREE),
+      fusion_(true),
+      analysis_(true),
+      planned_(false),
+      profiling_(false),
+      executed_(0),
+      runEngine_(Engine::TREE),
+      pc_(-1),
+      running_(false),
+      pendingInput_(-1),
+      suspendInput_(false),
+      samples_(nullptr),
+      symbols_(&SymbolTable::global()),
+      shared_(nullptr) {}
 
-Program::Program() : programCounter_(0), programEnd_(false) {}
+Program::Program(const Program& shared, int outputFd) : Program(outputFd) {
+    shared_ = &shared;
+    engine_ = shared.engine_;
+    fusion_ = shared.fusion_;
+    symbols_ = shared.symbols_;
+    analysis_ = shared.analysis_;
+    suspendInput_ = true;
+}
 
+// LIST 显示的语句文本：去掉行号前缀及其后的空格
+static std::string_view listText(std::string_view text) {
+    // 找到第一个非数字字符的位置（跳过行号）
+    size_t firstNonDigit = text.find_first_not_of("0123456789");
+    if (firstNonDigit == std::string_view::npos) {
+        return text;
+    }
+    // 跳过行号后的空格
+    size_t firstNonSpace = text.find_first_not_of(" \t", firstNonDigit);
+    if (firstNonSpace == std::string_view::npos) {
+        return {}; // 若行号后只有空格，则视为空语句
+    }
+    return text.substr(firstNonSpace); // 截取纯语句内容
+}
+
+// 执行索引与字节码都只更新被编辑的一行，RUN 之前不必整体重建
 void Program::addStmt(int line, Statement* stmt) {
     removeStmt(line);
-    recorder_.add(line, stmt);
+    int slot = recorder_.add(line, stmt);
+    if (cfg_ && slot >= 0) {
+        cfg_->update(recorder_, line, slot);
+    }
+    if (bytecode_ && slot >= 0) {
+        updateBytecode([&] { Compiler().insert(*bytecode_, recorder_, slot); });
+    }
 }
 
 void Program::removeStmt(int line) {
+    if (running_) {
+        finishRun(); // 执行索引即将失效，放弃暂停中的 RUN
+    }
+    int slot = recorder_.slotOf(line);
+    if (bytecode_ && slot >= 0) {
+        updateBytecode([&] { Compiler().remove(*bytecode_, recorder_, slot); });
+    }
     recorder_.remove(line);
+    if (cfg_ && slot >= 0) {
+        cfg_->update(recorder_, line, slot);
+    }
+}
+
+template <typename Update>
+void Program::updateBytecode(Update&& update) {
+    try {
+        update();
+    } catch (const BasicError&) {
+        // 无法编译的语句：下次 VM RUN 时整体编译并照常报错
+        bytecode_.reset();
+        jit_.reset();
+        return;
+    }
+    if (jit_) {
+        // 只作废覆盖了被改写位置的块，下次执行到时重新翻译
+        jit_->invalidate(*bytecode_);
+        if (jit_->wasteful()) {
+            jit_.reset();
+        }
+    }
+    bytecode_->patched.clear();
 }
 
-// 修改 src/Program.cpp 中的 run() 方法
 void Program::run() {
-    resetAfterRun(); // 重置运行状态（PC、结束标志）
-    
-    // 获取最小行号（第一个行号）
-    int firstLine = recorder_.nextLine(0);
-    if (firstLine == -1) {
-        return; // 无程序行时直接返回
-    }
-    
-    // 从开头运行
-    programCounter_ = firstLine;
-    programEnd_ = false;
+    run(engine_);
+}
 
-    while (!programEnd_) {
-        const Statement* currentStmt = recorder_.get(programCounter_);
-        if (!currentStmt) {
-            // 若当前行号不存在有效语句，终止运行
-            programEnd_ = true;
-            break;
+void Program::run(Engine engine) {
+    start(engine);
+    if (resume() == RunStatus::ERROR) {
+        throw BasicError(std::string(error_));
+    }
+}
+
+void Program::start() {
+    start(engine_);
+}
+
+void Program::start(Engine engine) {
+    finishRun();
+    executed_ = 0;
+    if (shared_) {
+        vars_.clear(); // 执行视图的每次 RUN 都从空的变量表开始
+    }
+    vars_.resetScopes(); // 每次 RUN 都从全局作用域开始
+    // 执行视图不能修改共用的程序，只使用其中已经准备好的引擎
+    runEngine_ = shared_ ? shared_->prepared(engine) : compile(engine);
+    const Program& program = source();
+    if (runEngine_ != Engine::TREE) {
+        vm_ = VMContext{};
+        vm_.ip = program.bytecode_->entry;
+        running_ = true;
+        return;
+    }
+    if (program.cfg_ && !profiling_) {
+        // 按执行计划运行：REM 与中转的 GOTO 已被穿透
+        if (program.cfg_->entry() == -1) {
+            return; // 没有需要执行的行
         }
+        base_ = program.cfg_->plan().data();
+        pc_ = program.cfg_->entry();
+        planned_ = true;
+        running_ = true;
+        return;
+    }
+    // 按执行索引逐行运行，跳转目标与下一行均已预先解析为槽位
+    if (program.recorder_.head() == -1) {
+        return; // 无程序行时直接结束
+    }
+    const std::vector<ExecLine>& lines = program.recorder_.slots();
+    base_ = lines.data();
+    pc_ = program.recorder_.head();
+    if (profiling_) {
+        samples_ = profiler_->begin(lines.size());
+    }
+    running_ = true;
+}
+
+Engine Program::prepare(Engine engine) {
+    Engine prepared = compile(engine);
+    if (prepared == Engine::JIT) {
+        jit_->translateReachable(*bytecode_); // 执行视图不能翻译
+    }
+    return prepared;
+}
 
-        // 记录当前PC用于判断是否被修改（如GOTO/IF）
-        int currentPC = programCounter_;
+Engine Program::compile(Engine engine) {
+    if (profiling_) {
+        return Engine::TREE;
+    }
+    if (engine == Engine::TREE) {
+        if (!analysis_) {
+            cfg_.reset();
+        } else if (!cfg_) {
+            cfg_ = std::make_unique<Cfg>(recorder_);
+        }
+        return Engine::TREE;
+    }
+    if (!bytecode_ || bytecode_->stale()) {
+        bytecode_ = std::make_unique<Bytecode>(Compiler().compile(recorder_));
+        jit_.reset();
+    }
+    if (engine == Engine::JIT && !jit_) {
+        jit_ = Jit().compile(*bytecode_);
+    }
+    // 不支持的平台：由 VM 执行
+    return engine == Engine::JIT && jit_ ? Engine::JIT : Engine::VM;
+}
 
-        // 执行当前语句
-        currentStmt->execute(vars_, *this);
+Engine Program::prepared(Engine engine) const noexcept {
+    if (engine == Engine::JIT && jit_) {
+        return Engine::JIT;
+    }
+    if (engine != Engine::TREE && bytecode_) {
+        return Engine::VM;
+    }
+    return Engine::TREE;
+}
 
-        if (programEnd_) {
+RunStatus Program::step(uint64_t maxStatements) {
+    if (pendingInput_ >= 0) {
+        return RunStatus::NEEDS_INPUT;
+    }
+    if (!running_) {
+        return RunStatus::FINISHED;
+    }
+    if (runEngine_ == Engine::JIT) {
+        return stepJit(maxStatements);
+    }
+    if (runEngine_ == Engine::VM) {
+        return stepVM(maxStatements);
+    }
+    return samples_ ? stepTree<true>(maxStatements) : stepTree<false>(maxStatements);
+}
+
+RunStatus Program::resume() {
+    return step(VM::kUnlimited);
+}
+
+RunStatus Program::stepVM(uint64_t maxStatements) {
+    vm_.suspendInput = suspendInput_;
+    switch (VM().run(*source().bytecode_, vars_, output_, vm_, maxStatements)) {
+        case VMExit::INPUT:
+            requestInput(vm_.inputSlot);
+            return RunStatus::NEEDS_INPUT;
+        case VMExit::BUDGET:
+            return RunStatus::BUDGET_EXHAUSTED;
+        case VMExit::ERROR:
+            error_ = vm_.fault.message();
+            finishRun();
+            return RunStatus::ERROR;
+        case VMExit::HALT:
             break;
-        }
+    }
+    finishRun();
+    return RunStatus::FINISHED;
+}
 
-        // 检查PC是否被跳转语句修改
-        if (programCounter_ != currentPC) {
-            // 如果PC被修改，直接进入下一次循环执行目标行
-            continue;
+RunStatus Program::stepJit(uint64_t maxStatements) {
+    vm_.suspendInput = suspendInput_;
+    uint64_t budget = maxStatements;
+    for (;;) {
+        switch (source().jit_->run(vars_, output_, vm_, budget)) {
+            case JitExit::MISS:
+                // 执行到尚未翻译的位置：翻译这一块后继续。执行视图不能修改
+                // 共用的本机代码，无法翻译时本次 RUN 余下的部分由 VM 执行
+                if (shared_ == nullptr &&
+                    jit_->translate(*bytecode_, vm_.ip, budget != VM::kUnlimited)) {
+                    continue;
+                }
+                runEngine_ = Engine::VM;
+                return stepVM(budget);
+            case JitExit::INPUT:
+                requestInput(vm_.inputSlot);
+                return RunStatus::NEEDS_INPUT;
+            case JitExit::BUDGET:
+                return RunStatus::BUDGET_EXHAUSTED;
+            case JitExit::ERROR:
+                error_ = vm_.fault.message();
+                finishRun();
+                return RunStatus::ERROR;
+            case JitExit::HALT:
+                break;
         }
+        finishRun();
+        return RunStatus::FINISHED;
+    }
+}
 
-        // PC未被修改，自动进入下一行
-        int nextLine = recorder_.nextLine(currentPC);
-        if (nextLine == -1) {
-            // 无下一行时终止
-            programEnd_ = true;
-        } else {
-            programCounter_ = nextLine;
+// Profiled 为 false 时剖析代码在编译期整体去除，主循环与未剖析时完全一致
+template <bool Profiled>
+RunStatus Program::stepTree(uint64_t maxStatements) {
+    // 本次调用执行的条数；gotoLine 顺带执行的 IF 直接计入 executed_
+    uint64_t executed = 0;
+    uint64_t remaining = maxStatements;
+    int pc = pc_;
+    try {
+        while (pc != -1) {
+            // 执行计划中的计数循环整轮执行；剖析时不使用执行计划
+            if constexpr (!Profiled) {
+                if (base_[pc].loop >= 0 && runLoop(pc, remaining, executed)) {
+                    if (programEnd_) {
+                        break;
+                    }
+                    continue;
+                }
+            }
+            if (remaining-- == 0) {
+                // 预算用完，下次从 pc 继续
+                pc_ = pc;
+                executed_ += executed;
+                return RunStatus::BUDGET_EXHAUSTED;
+            }
+            current_ = base_ + pc;
+            jumped_ = false;
+            ++executed;
+
+            // 执行当前语句
+            if constexpr (Profiled) {
+                LineProfile& sample = samples_[pc];
+                ++sample.hits;
+                uint64_t start = Profiler::now();
+                current_->stmt->execute(vars_, *this);
+                sample.ticks += Profiler::now() - start;
+                if (current_->stmt->kind() == StmtKind::IF) {
+                    ++(jumped_ ? sample.taken : sample.untaken);
+                }
+            } else {
+                current_->stmt->execute(vars_, *this);
+            }
+
+            // END、INPUT 暂停与运行时错误都经由 programEnd_ 停下主循环
+            if (programEnd_) {
+                break;
+            }
+            // 跳转语句修改了 PC（跳回本行同样算作跳转），否则进入下一行
+            pc = jumped_ ? nextIndex_ : current_->next;
         }
+    } catch (...) {
+        executed_ += executed;
+        finishRun();
+        throw;
     }
 
-    resetAfterRun();
+    executed_ += executed;
+    if (fault_) {
+        error_ = fault_.message();
+        fault_ = Fault{};
+        finishRun();
+        return RunStatus::ERROR;
+    }
+    if (pendingInput_ >= 0) {
+        // INPUT 暂停了主循环：provideInput 之后从下一行继续
+        programEnd_ = false;
+        pc_ = pc;
+        return RunStatus::NEEDS_INPUT;
+    }
+    finishRun();
+    return RunStatus::FINISHED;
 }
 
-void Program::list() const {
-    int currentLine = 0;
-    while (true) {
-        int nextLine = recorder_.nextLine(currentLine);
-        if (nextLine == -1) {
+// 计数器放在局部变量中，循环体不读取它时只在离开循环时写回；不经过主循环的
+// 逐条分发，递增与条件判断也不再经过语句。闭式可求时直接算出结果
+bool Program::runLoop(int& pc, uint64_t& remaining, uint64_t& executed) {
+    const CountedLoop& loop = source().cfg_->loop(base_[pc].loop);
+    uint64_t length = loop.length;
+    uint64_t rounds = remaining / length;
+    // 变量未定义时交给主循环逐条执行，照常报错
+    if (rounds == 0 || !vars_.isDefined(loop.counter) ||
+        (loop.limitSlot >= 0 && !vars_.isDefined(loop.limitSlot))) {
+        return false;
+    }
+    uint64_t done = loop.evaluate(vars_, rounds);
+    if (done > 0) {
+        executed += done * length;
+        remaining -= done * length;
+        pc = base_[loop.tail].next;
+        return true;
+    }
+
+    const ExecLine* body = base_ + loop.head;
+    const ExecLine* increment = base_ + loop.increment;
+    int counter = vars_.peek(loop.counter);
+    int limit = loop.limitSlot >= 0 ? vars_.peek(loop.limitSlot) : loop.limit;
+    bool stale = false; // 计数器是否还没有写回
+    pc = loop.head; // 预算用完时停在循环首行
+    for (; rounds > 0; --rounds) {
+        for (current_ = body; current_ != increment;
+             current_ = base_ + current_->next) {
+            ++executed;
+            --remaining;
+            current_->stmt->execute(vars_, *this);
+            if (programEnd_) {
+                break; // 循环体只有 LET，只会是运行时错误
+            }
+        }
+        if (programEnd_) {
             break;
         }
-        const Statement* stmt = recorder_.get(nextLine);
-        if (stmt) {
-            // 提取 stmt->text() 中除去行号前缀的纯语句内容
-            std::string text = stmt->text();
-            // 找到第一个非数字字符的位置（跳过行号）
-            size_t firstNonDigit = text.find_first_not_of("0123456789");
-            if (firstNonDigit != std::string::npos) {
-                // 跳过行号后的空格
-                size_t firstNonSpace = text.find_first_not_of(" \t", firstNonDigit);
-                if (firstNonSpace != std::string::npos) {
-                    text = text.substr(firstNonSpace); // 截取纯语句内容
-                } else {
-                    text = ""; // 若行号后只有空格，则视为空语句
-                }
-            }
-            // 输出：行号 + 空格 + 纯语句内容
-            std::cout << nextLine << " " << text << std::endl;
+        ++executed;
+        --remaining;
+        Fault fault;
+        int next = arith::narrow(arith::add(counter, loop.step, fault), fault);
+        if (fault) {
+            current_ = increment;
+            raise(fault);
+            break;
+        }
+        counter = next;
+        ++executed;
+        --remaining;
+        stale = !loop.readsCounter;
+        if (loop.readsCounter) {
+            vars_.setValue(loop.counter, counter);
+        }
+        if (!(counter < limit)) {
+            pc = base_[loop.tail].next;
+            break;
         }
-        currentLine = nextLine;
+    }
+    if (stale) {
+        vars_.setValue(loop.counter, counter);
+    }
+    return true;
+}
+
+void Program::list() const {
+    recorder_.forEach([this](const ExecLine& entry) {
+        // 输出：行号 + 空格 + 纯语句内容
+        output_ << entry.line << ' ' << listText(entry.stmt->text()) << '\n';
+    });
+}
+
+// 右对齐输出到固定宽度的列
+static void column(Output& out, const std::string& text, size_t width) {
+    for (size_t i = text.size(); i < width; ++i) {
+        out << ' ';
+    }
+    out << text;
+}
+
+void Program::printProfile(bool timed) const {
+    if (!profiler_) {
+        return;
+    }
+    std::vector<std::pair<int, LineProfile>> rows(profiler_->totals().begin(),
+                                                  profiler_->totals().end());
+    uint64_t total = 0;
+    for (const auto& row : rows) {
+        total += row.second.ticks;
+    }
+    // 按耗时降序，耗时相同按行号升序；不计时的报告保持行号顺序
+    if (timed) {
+        std::stable_sort(rows.begin(), rows.end(),
+                         [](const auto& a, const auto& b) {
+                             return a.second.ticks > b.second.ticks;
+                         });
+    }
+
+    column(output_, "LINE", 6);
+    column(output_, "HITS", 12);
+    if (timed) {
+        column(output_, Profiler::unit(), 16);
+        column(output_, "%", 7);
+    }
+    column(output_, "TAKEN", 10);
+    column(output_, "UNTAKEN", 10);
+    output_ << "  TEXT\n";
+    for (const auto& [line, sample] : rows) {
+        // 以千分比计算，避免浮点格式化
+        uint64_t permille = total == 0 ? 0 : sample.ticks * 1000 / total;
+        std::string share = std::to_string(permille / 10) + '.' +
+                            std::to_string(permille % 10);
+        bool isIf = sample.taken + sample.untaken > 0;
+        column(output_, std::to_string(line), 6);
+        column(output_, std::to_string(sample.hits), 12);
+        if (timed) {
+            column(output_, std::to_string(sample.ticks), 16);
+            column(output_, share, 7);
+        }
+        column(output_, isIf ? std::to_string(sample.taken) : "-", 10);
+        column(output_, isIf ? std::to_string(sample.untaken) : "-", 10);
+        output_ << "  ";
+        // 剖析之后被删除的行不再有文本
+        const Statement* stmt = recorder_.get(line);
+        if (stmt != nullptr) {
+            output_ << listText(stmt->text());
+        }
+        output_ << '\n';
     }
 }
 
 void Program::clear() {
+    finishRun();
     recorder_.clear();
+    cfg_.reset();
+    bytecode_.reset();
+    jit_.reset();
+    if (profiler_) {
+        profiler_->reset();
+    }
     vars_.clear();
-    resetAfterRun();
+}
+
+void Program::saveImage(const std::string& path) const {
+    Image::save(recorder_, *symbols_, path);
+}
+
+void Program::loadImage(const std::string& path) {
+    MappedFile file(path);
+    // 先完整校验并重建全部语句，映像损坏时程序保持不变
+    Recorder::Batch lines = Image::load(file.contents(), *symbols_, fusion_);
+    if (running_) {
+        finishRun(); // 执行索引即将失效，放弃暂停中的 RUN
+    }
+    recorder_.addSorted(std::move(lines));
+    cfg_.reset();
+    bytecode_.reset();
+    jit_.reset();
 }
 
 void Program::execute(Statement* stmt) {
+    bool ended = programEnd_;
     stmt->execute(vars_, *this);
+    if (fault_) {
+        // 立即执行不在主循环中，恢复 raise 改动的 programEnd_ 后在 REPL 边界报错
+        programEnd_ = ended;
+        throw BasicError(std::exchange(fault_, Fault{}));
+    }
+}
+
+bool Program::running() const noexcept {
+    return running_;
+}
+
+void Program::stop() {
+    finishRun();
+}
+
+bool Program::awaitingInput() const noexcept {
+    return pendingInput_ >= 0;
+}
+
+const std::string& Program::lastError() const noexcept {
+    return error_;
+}
+
+bool Program::provideInput(std::string_view line) {
+    if (pendingInput_ < 0) {
+        return false;
+    }
+    std::optional<int> value = InputStatement::parseValue(line);
+    if (!value) {
+        output_ << "INVALID NUMBER\n" << " ? ";
+        return false;
+    }
+    vars_.setValue(pendingInput_, *value);
+    pendingInput_ = -1;
+    if (running_ && runEngine_ == Engine::TREE) {
+        // RUN 中的 INPUT 完成，从下一行继续；VM 的暂停位置已在 INPUT 之后
+        pc_ = base_[pc_].next;
+        if (pc_ == -1) {
+            finishRun();
+        }
+    }
+    return true;
+}
+
+void Program::setSuspendInput(bool enabled) noexcept {
+    suspendInput_ = enabled;
+}
+
+bool Program::suspendInput() const noexcept {
+    return suspendInput_;
+}
+
+void Program::requestInput(int slot) {
+    pendingInput_ = slot;
+    output_ << " ? ";
+    if (current_ != nullptr) {
+        programEnd_ = true; // 树遍历 RUN 中：停下主循环，由 stepTree 区分
+    }
 }
 
 int Program::getPC() const noexcept {
-    return programCounter_;
+    return current_ ? current_->line : programCounter_;
 }
 
 void Program::changePC(int line) {
     programCounter_ = line;
+    jumped_ = true;
+    if (current_) {
+        const Program& program = source();
+        // 执行计划与执行索引的下标同为槽位
+        nextIndex_ = program.recorder_.slotOf(line);
+    }
+}
+
+void Program::jumpTo(int line) {
+    if (!current_) {
+        // 立即执行的跳转：仅检查目标行并修改 PC
+        if (!source().recorder_.hasLine(line)) {
+            raise(Fault{ErrorCode::LINE_NUMBER_ERROR, line});
+            return;
+        }
+        changePC(line);
+        return;
+    }
+    // RUN 期间优先使用执行索引中预解析的目标；执行计划中的目标已穿透 GOTO，
+    // 行号可能与 line 不同，为 -1 即目标行不存在
+    int target = current_->target;
+    if (!planned_ && (target < 0 || base_[target].line != line)) {
+        target = source().recorder_.slotOf(line);
+    }
+    if (target < 0) {
+        raise(Fault{ErrorCode::LINE_NUMBER_ERROR, line});
+        return;
+    }
+    nextIndex_ = target;
+    jumped_ = true;
+}
+
+void Program::gotoLine(int line) {
+    jumpTo(line);
+    // 剖析时不融合，保证每行各自计数
+    if (fault_ || !fusion_ || !current_ || samples_) {
+        return;
+    }
+    const ExecLine* target = base_ + nextIndex_;
+    if (target->kind != StmtKind::IF) {
+        return;
+    }
+    // 把目标行当作当前行执行：IF 未跳转时由主循环进入它的下一行
+    current_ = target;
+    jumped_ = false;
+    ++executed_;
+    target->stmt->execute(vars_, *this);
 }
 
 void Program::programEnd() {
     programEnd_ = true;
 }
 
+void Program::raise(const Fault& fault) noexcept {
+    fault_ = fault;
+    programEnd_ = true;
+}
+
+void Program::setEngine(Engine engine) noexcept {
+    engine_ = engine;
+}
+
+Engine Program::engine() const noexcept {
+    return engine_;
+}
+
+void Program::setFusion(bool enabled) noexcept {
+    fusion_ = enabled;
+}
+
+bool Program::fusion() const noexcept {
+    return fusion_;
+}
+
+void Program::setAnalysis(bool enabled) noexcept {
+    analysis_ = enabled;
+}
+
+bool Program::analysis() const noexcept {
+    return analysis_;
+}
+
+void Program::analyze() {
+    if (!cfg_) {
+        cfg_ = std::make_unique<Cfg>(recorder_);
+    }
+    cfg_->print(recorder_, output_);
+}
+
+void Program::setSymbols(SymbolTable& symbols) noexcept {
+    symbols_ = &symbols;
+}
+
+Output& Program::output() noexcept {
+    return output_;
+}
+
+void Program::setProfiling(bool enabled) {
+    finishRun();
+    if (enabled) {
+        if (!profiler_) {
+            profiler_ = std::make_unique<Profiler>();
+        }
+        profiler_->reset();
+    }
+    profiling_ = enabled;
+}
+
+bool Program::profiling() const noexcept {
+    return profiling_;
+}
+
+uint64_t Program::executedStatements() const noexcept {
+    return executed_;
+}
+
+void Program::finishRun() {
+    if (samples_) {
+        samples_ = nullptr;
+        profiler_->end(recorder_.slots());
+    }
+    resetAfterRun();
+}
+
 void Program::resetAfterRun() noexcept {
+    pc_ = -1;
+    running_ = false;
+    pendingInput_ = -1;
     programCounter_ = 0;
     programEnd_ = false;
+    jumped_ = false;
+    base_ = nullptr;
+    planned_ = false;
+    current_ = nullptr;
+    nextIndex_ = -1;
 }
\ No newline at end of file
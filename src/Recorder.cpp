@@ -1,49 +1,216 @@
 // TODO: Imply interfaces declared in the Recorder.hpp.
 #include "Recorder.hpp"
 
+#include <algorithm>
+
 Recorder::~Recorder() {
-    clear(); 
+    clear();
 }
 
 // 插入语句
-void Recorder::add(int line, Statement* stmt) {
+int Recorder::add(int line, Statement* stmt) {
   // 若已存在先删旧的
-  if (hasLine(line)) {
-    delete statements_[line];
+  auto it = place(lines_.lower_bound(line), line);
+  attach(it, stmt);
+  return line > 0 ? it->second : -1;
+}
+
+void Recorder::addSorted(Batch&& lines) {
+  if (lines.empty()) {
+    return;
   }
-  statements_[line] = stmt;
+  auto hint = lines_.begin();
+  for (auto& [line, stmt] : lines) {
+    // 行号升序时新行恰好插在 hint 之前；行号已存在时沿用原来的槽位
+    auto it = lines_.emplace_hint(hint, line, -1);
+    if (it->second == -1) {
+      it->second = allocate();
+    } else {
+      delete slots_[it->second].stmt;
+    }
+    slots_[it->second] = ExecLine{line, stmt->kind(), stmt.get(), -1, -1, -1};
+    stmt.release();
+    hint = std::next(it);
+  }
+  // 整批加入时逐行接入并不划算，一次性重新串起执行顺序与跳转目标
+  relink();
 }
 
 // 删除
 void Recorder::remove(int line) {
-  auto it = statements_.find(line);
-  if (it != statements_.end()) {
-    delete it->second;
-    statements_.erase(it);
+  auto it = lines_.find(line);
+  if (it != lines_.end()) {
+    detach(it);
+    lines_.erase(it);
   }
 }
 
 // 获取指定行（不存在则nullptr）
 const Statement* Recorder::get(int line) const noexcept {
-  auto it = statements_.find(line);
-  return (it != statements_.end()) ? it->second : nullptr;
+  auto it = lines_.find(line);
+  return (it != lines_.end()) ? slots_[it->second].stmt : nullptr;
 }
 
 // 检查指定行号是否存在语句
 bool Recorder::hasLine(int line) const noexcept {
-  return statements_.count(line) > 0;
+  return lines_.count(line) > 0;
 }
 
 // 清空所有语句并释放内存
 void Recorder::clear() noexcept {
-  for (auto& [line, stmt] : statements_) {
-    delete stmt;
+  for (auto& [line, slot] : lines_) {
+    delete slots_[slot].stmt;
   }
-  statements_.clear();
+  lines_.clear();
+  slots_.clear();
+  referrers_.clear();
+  head_ = -1;
+  free_ = -1;
 }
 
 // 返回大于指定行号的最小行号（不存在则-1）
 int Recorder::nextLine(int line) const noexcept {
-  auto it = statements_.upper_bound(line);
-  return (it != statements_.end()) ? it->first : -1;
+  auto it = lines_.upper_bound(line);
+  return (it != lines_.end()) ? it->first : -1;
+}
+
+int Recorder::slotOf(int line) const {
+  // 与 RUN 的历史行为一致：行号不大于 0 的行不参与执行
+  if (line <= 0) {
+    return -1;
+  }
+  auto it = lines_.find(line);
+  return it != lines_.end() ? it->second : -1;
+}
+
+int Recorder::prevSlot(int line) const {
+  auto it = lines_.lower_bound(line);
+  if (it == lines_.begin() || std::prev(it)->first <= 0) {
+    return -1;
+  }
+  return std::prev(it)->second;
+}
+
+Recorder::Lines::iterator Recorder::place(Lines::iterator hint, int line) {
+  auto it = lines_.emplace_hint(hint, line, -1);
+  if (it->second != -1) {
+    detach(it);
+  }
+  return it;
+}
+
+// 新行接在按行号的前一行之后，并解析自己的跳转目标、接上以它为目标的跳转
+void Recorder::attach(Lines::iterator it, Statement* stmt) {
+  int line = it->first;
+  int slot = allocate();
+  it->second = slot;
+  slots_[slot] = ExecLine{line, stmt->kind(), stmt, -1, -1, -1};
+  if (line <= 0) {
+    return;
+  }
+
+  ExecLine& entry = slots_[slot];
+  auto after = std::next(it);
+  entry.next = after != lines_.end() ? after->second : -1;
+  if (it != lines_.begin() && std::prev(it)->first > 0) {
+    slots_[std::prev(it)->second].next = slot;
+  } else {
+    head_ = slot;
+  }
+
+  int target = targetLine(entry);
+  if (target > 0) {
+    entry.target = slotOf(target);
+    refer(target, slot);
+  }
+  forEachReferrer(line, [&](int from) { slots_[from].target = slot; });
+}
+
+void Recorder::detach(Lines::iterator it) {
+  int line = it->first;
+  int slot = it->second;
+  ExecLine& entry = slots_[slot];
+  if (line > 0) {
+    if (it != lines_.begin() && std::prev(it)->first > 0) {
+      slots_[std::prev(it)->second].next = entry.next;
+    } else {
+      head_ = entry.next;
+    }
+
+    int target = targetLine(entry);
+    if (target > 0) {
+      unrefer(target, slot);
+    }
+    forEachReferrer(line, [&](int from) { slots_[from].target = -1; });
+  }
+
+  delete entry.stmt;
+  entry = ExecLine{0, StmtKind::REM, nullptr, free_, -1, -1};
+  free_ = slot;
+  it->second = -1;
+}
+
+void Recorder::relink() {
+  referrers_.clear();
+  referrers_.reserve(lines_.size());
+  head_ = -1;
+  int last = -1;
+  for (auto it = lines_.upper_bound(0); it != lines_.end(); ++it) {
+    if (last == -1) {
+      head_ = it->second;
+    } else {
+      slots_[last].next = it->second;
+    }
+    last = it->second;
+  }
+  if (last != -1) {
+    slots_[last].next = -1;
+  }
+  for (int slot = head_; slot != -1; slot = slots_[slot].next) {
+    ExecLine& entry = slots_[slot];
+    int target = targetLine(entry);
+    if (target > 0) {
+      entry.target = slotOf(target);
+      refer(target, slot);
+    }
+  }
+}
+
+int Recorder::allocate() {
+  if (free_ == -1) {
+    slots_.emplace_back();
+    return static_cast<int>(slots_.size()) - 1;
+  }
+  int slot = free_;
+  free_ = slots_[slot].next;
+  return slot;
+}
+
+void Recorder::refer(int target, int slot) {
+  auto [it, inserted] = referrers_.try_emplace(target, slot);
+  slots_[slot].nextReferrer = inserted ? -1 : it->second;
+  it->second = slot;
+}
+
+void Recorder::unrefer(int target, int slot) {
+  auto it = referrers_.find(target);
+  int* link = &it->second;
+  while (*link != slot) {
+    link = &slots_[*link].nextReferrer;
+  }
+  *link = slots_[slot].nextReferrer;
+  if (it->second == -1) {
+    referrers_.erase(it);
+  }
+}
+
+int Recorder::targetLine(const ExecLine& entry) noexcept {
+  switch (entry.kind) {
+    case StmtKind::GOTO:
+      return static_cast<const GotoStatement*>(entry.stmt)->targetLine();
+    case StmtKind::IF:
+      return static_cast<const IfStatement*>(entry.stmt)->targetLine();
+    default:
+      return -1;
+  }
 }
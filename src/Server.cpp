@@ -0,0 +1,308 @@
+#include "Server.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include "utils/Error.hpp"
+
+Server::Session::Session(int socket, Engine engine)
+    : fd(socket), interpreter(-1) {
+  interpreter.setResumable(true);
+  interpreter.program().setEngine(engine);
+  interpreter.program().output().captureTo(&output);
+}
+
+Server::Server(Options options) : options_(std::move(options)) {
+  if (options_.workers == 0) {
+    options_.workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+  if (options_.budget == 0) {
+    options_.budget = kDefaultBudget;
+  }
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (options_.path.empty() || options_.path.size() >= sizeof(addr.sun_path)) {
+    throw BasicError("INVALID SOCKET PATH");
+  }
+  std::memcpy(addr.sun_path, options_.path.c_str(), options_.path.size() + 1);
+
+  // 对端关闭后再写入不应终止整个服务器
+  std::signal(SIGPIPE, SIG_IGN);
+
+  listener_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  epoll_ = ::epoll_create1(EPOLL_CLOEXEC);
+  wakeup_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (listener_ < 0 || epoll_ < 0 || wakeup_ < 0) {
+    throw BasicError("CANNOT CREATE SOCKET");
+  }
+  ::unlink(options_.path.c_str());
+  if (::bind(listener_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+      ::listen(listener_, SOMAXCONN) < 0) {
+    throw BasicError("CANNOT BIND SOCKET");
+  }
+
+  // 监听套接字与唤醒用的 eventfd 都是水平触发，不带 EPOLLONESHOT；
+  // data.ptr 为空表示监听套接字，指向 wakeup_ 表示停止
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.ptr = nullptr;
+  ::epoll_ctl(epoll_, EPOLL_CTL_ADD, listener_, &event);
+  event.data.ptr = &wakeup_;
+  ::epoll_ctl(epoll_, EPOLL_CTL_ADD, wakeup_, &event);
+}
+
+Server::~Server() {
+  stop();
+  for (std::thread& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  for (auto& [raw, session] : sessions_) {
+    if (session->fd >= 0) {
+      ::close(session->fd);
+    }
+  }
+  sessions_.clear();
+  if (listener_ >= 0) {
+    ::close(listener_);
+    ::unlink(options_.path.c_str());
+  }
+  if (epoll_ >= 0) {
+    ::close(epoll_);
+  }
+  if (wakeup_ >= 0) {
+    ::close(wakeup_);
+  }
+}
+
+void Server::serve() {
+  for (unsigned i = 0; i < options_.workers; ++i) {
+    workers_.emplace_back(&Server::workerLoop, this);
+  }
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void Server::stop() {
+  // eventfd 从不被读取，保持可读，所有工作线程都会看到并退出
+  uint64_t one = 1;
+  if (wakeup_ >= 0) {
+    ssize_t ignored = ::write(wakeup_, &one, sizeof(one));
+    (void)ignored;
+  }
+}
+
+void Server::workerLoop() {
+  epoll_event event;
+  while (true) {
+    int ready = ::epoll_wait(epoll_, &event, 1, -1);
+    if (ready < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    if (ready == 0) {
+      continue;
+    }
+    if (event.data.ptr == &wakeup_) {
+      return;
+    }
+    if (event.data.ptr == nullptr) {
+      acceptClients();
+      continue;
+    }
+    // EPOLLONESHOT 保证在重新注册前只有本线程处理该会话
+    Session* session = static_cast<Session*>(event.data.ptr);
+    bool keep;
+    {
+      std::lock_guard<std::mutex> lock(session->mutex);
+      keep = handle(session, event.events);
+    }
+    if (!keep) {
+      close(session);
+    }
+  }
+}
+
+void Server::acceptClients() {
+  while (true) {
+    int fd = ::accept4(listener_, nullptr, nullptr,
+                       SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      // EAGAIN：已被其他线程取走或暂无连接
+      return;
+    }
+    auto session = std::make_unique<Session>(fd, options_.engine);
+    Session* raw = session.get();
+    {
+      std::lock_guard<std::mutex> lock(sessionsMutex_);
+      sessions_.emplace(raw, std::move(session));
+    }
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.ptr = raw;
+    if (::epoll_ctl(epoll_, EPOLL_CTL_ADD, fd, &event) < 0) {
+      close(raw);
+    }
+  }
+}
+
+bool Server::handle(Session* session, uint32_t events) {
+  if (events & (EPOLLHUP | EPOLLERR)) {
+    // 对端已完全断开（只关闭写端时仅有 EPOLLRDHUP），不必再执行
+    return false;
+  }
+  if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+    receive(session);
+  }
+  bool yielded = drive(session);
+  session->interpreter.program().output().flush();
+  send(session);
+
+  if (session->fd < 0) {
+    // 发送失败，对端已断开
+    return false;
+  }
+  size_t pendingOutput = session->output.size() - session->sent;
+  size_t pendingInput = session->input.size() - session->consumed;
+  if (pendingOutput == 0 && !yielded) {
+    // QUIT 之后，或对端关闭写端且剩余输入都已处理，输出发完即可关闭；
+    // 此时若程序仍停在 INPUT 上，也不会再有输入到来
+    bool stalled = session->eof || pendingInput >= kMaxBuffered;
+    if (session->quit || stalled) {
+      return false;
+    }
+  }
+  uint32_t interest = 0;
+  if (!session->eof && !session->quit && pendingInput < kMaxBuffered) {
+    interest |= EPOLLIN | EPOLLRDHUP;
+  }
+  // 用完预算的会话以 EPOLLOUT 重新排队：套接字可写时立刻就绪，
+  // 但排在其他已就绪会话之后，从而轮流执行
+  if (yielded || pendingOutput > 0) {
+    interest |= EPOLLOUT;
+  }
+  rearm(session, interest);
+  return true;
+}
+
+bool Server::drive(Session* session) {
+  Program& program = session->interpreter.program();
+  std::string line;
+  while (!session->quit) {
+    // 对端读取太慢时先停下，等输出发送后再继续
+    if (session->output.size() - session->sent >= kMaxBuffered) {
+      return false;
+    }
+    if (program.awaitingInput()) {
+      if (!nextLine(session, line)) {
+        return false;
+      }
+      program.provideInput(line);
+    } else if (program.running()) {
+      RunStatus status = program.step(options_.budget);
+      if (status == RunStatus::BUDGET_EXHAUSTED) {
+        return true;
+      }
+      if (status == RunStatus::ERROR) {
+        program.output() << program.lastError() << '\n';
+      }
+    } else {
+      if (!nextLine(session, line)) {
+        return false;
+      }
+      session->quit = !session->interpreter.processLine(line);
+    }
+  }
+  return false;
+}
+
+bool Server::nextLine(Session* session, std::string& line) {
+  std::string& input = session->input;
+  size_t end = input.find('\n', session->consumed);
+  if (end == std::string::npos) {
+    // 连接关闭时，末尾没有换行的内容也算作一行，与 getline 一致
+    if (!session->eof || session->consumed == input.size()) {
+      return false;
+    }
+    end = input.size();
+  }
+  line.assign(input, session->consumed, end - session->consumed);
+  session->consumed = std::min(end + 1, input.size());
+  return true;
+}
+
+void Server::receive(Session* session) {
+  std::string& input = session->input;
+  // 丢弃已处理的部分
+  input.erase(0, session->consumed);
+  session->consumed = 0;
+  char buffer[4096];
+  while (input.size() < kMaxBuffered) {
+    ssize_t n = ::recv(session->fd, buffer, sizeof(buffer), 0);
+    if (n > 0) {
+      input.append(buffer, n);
+    } else if (n == 0) {
+      session->eof = true;
+      return;
+    } else if (errno == EINTR) {
+      continue;
+    } else {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        session->eof = true;
+      }
+      return;
+    }
+  }
+}
+
+void Server::send(Session* session) {
+  std::string& output = session->output;
+  while (session->sent < output.size()) {
+    ssize_t n = ::send(session->fd, output.data() + session->sent,
+                       output.size() - session->sent, MSG_NOSIGNAL);
+    if (n > 0) {
+      session->sent += n;
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else {
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        // 对端已断开：标记后由 handle 关闭
+        ::close(session->fd);
+        session->fd = -1;
+      }
+      return;
+    }
+  }
+  output.clear();
+  session->sent = 0;
+}
+
+void Server::rearm(Session* session, uint32_t events) {
+  epoll_event event{};
+  event.events = events | EPOLLONESHOT;
+  event.data.ptr = session;
+  ::epoll_ctl(epoll_, EPOLL_CTL_MOD, session->fd, &event);
+}
+
+void Server::close(Session* session) {
+  int fd = session->fd;
+  if (fd >= 0) {
+    // close 会自动把 fd 从 epoll 中移除
+    ::close(fd);
+  }
+  std::lock_guard<std::mutex> lock(sessionsMutex_);
+  sessions_.erase(session);
+}
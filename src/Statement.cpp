@@ -5,6 +5,7 @@
 #include <sstream>
 #include <utility>
 
+#include "Arith.hpp"
 #include "Program.hpp"
 #include "VarState.hpp"
 #include "utils/Error.hpp"
@@ -35,90 +36,210 @@ bool isValidInteger(const std::string& s) {
     return true;
 }
 
-Statement::Statement(std::string source) : source_(std::move(source)) {}
+Statement::Statement(std::string_view source) : source_(source) {}
 
-const std::string& Statement::text() const noexcept { return source_; }
+std::string_view Statement::text() const noexcept { return source_; }
+
+void Statement::adoptArena(Arena&& arena) noexcept {
+    arena_ = std::move(arena);
+}
+
+void Statement::shareArena(std::shared_ptr<const Arena> arena) noexcept {
+    sharedArena_ = std::move(arena);
+}
 
 // TODO: Imply interfaces declared in the Statement.hpp.
 
+namespace {
+
+template <char Op>
+bool compare(int lhs, int rhs) {
+    if constexpr (Op == '=') {
+        return lhs == rhs;
+    } else if constexpr (Op == '<') {
+        return lhs < rhs;
+    } else {
+        return lhs > rhs;
+    }
+}
+
+// 按运算符实例化融合的 IF，只接受 = < >
+template <template <char> class Fused, typename... Args>
+IfStatement* withOp(char op, Args... args) {
+    switch (op) {
+        case '=':
+            return new Fused<'='>(args...);
+        case '<':
+            return new Fused<'<'>(args...);
+        case '>':
+            return new Fused<'>'>(args...);
+        default:
+            return nullptr;
+    }
+}
+
+int slotOf(const Expression* expr) {
+    return static_cast<const VariableExpression*>(expr)->slot();
+}
+
+int valueOf(const Expression* expr) {
+    return static_cast<const ConstExpression*>(expr)->value();
+}
+
+}  // namespace
+
+LetStatement* LetStatement::create(std::string_view source, int var_slot,
+                                   Expression* expr, bool fused) {
+    if (fused && expr->kind() == ExprKind::COMPOUND) {
+        auto* compound = static_cast<const CompoundExpression*>(expr);
+        const Expression* lhs = compound->left();
+        const Expression* rhs = compound->right();
+        char op = compound->op();
+        if (op == '+' && lhs->kind() == ExprKind::CONST) {
+            std::swap(lhs, rhs);
+        }
+        if ((op == '+' || op == '-') && lhs->kind() == ExprKind::VARIABLE &&
+            rhs->kind() == ExprKind::CONST) {
+            int value = valueOf(rhs);
+            // INT_MIN 取反会溢出，保留普通语句
+            if (op == '+' || value != std::numeric_limits<int>::min()) {
+                return new IncrementStatement(source, var_slot, expr, slotOf(lhs),
+                                              op == '+' ? value : -value);
+            }
+        }
+    }
+    return new LetStatement(source, var_slot, expr);
+}
+
 void LetStatement::execute(VarState& state, Program& program) const {
-    int value = assignexpr->evaluate(state);
-    state.setValue(var_name_, value);
+    Fault fault;
+    int value = arith::narrow(assignexpr->evaluate(state, fault), fault);
+    if (fault) {
+        program.raise(fault);
+        return;
+    }
+    state.setValue(var_slot_, value);
+}
+
+void IncrementStatement::execute(VarState& state, Program& program) const {
+    Fault fault;
+    arith::Word sum = arith::add(state.getValue(from_slot_, fault), delta_, fault);
+    int value = arith::narrow(sum, fault);
+    if (fault) {
+        program.raise(fault);
+        return;
+    }
+    state.setValue(varSlot(), value);
 }
 
 void PrintStatement::execute(VarState& state, Program& program) const {
-    try {
-        int value = assignexpr->evaluate(state);
-        std::cout << value << std::endl;
-    } catch (const BasicError& e) {
-        // 捕获变量未定义的错误，输出指定信息
-        if (e.what() == std::string("VARIABLE NOT DEFINED")) {
-            std::cout << "VARIABLE NOT DEFINED" << std::endl;
-        } else {
-            throw; // 其他错误继续抛出
-        }
+    Fault fault;
+    arith::Word value = assignexpr->evaluate(state, fault);
+    if (!fault) {
+        program.output() << value << '\n';
+    } else if (fault.code == ErrorCode::VARIABLE_NOT_DEFINED) {
+        // 变量未定义时输出指定信息后继续执行
+        program.output() << "VARIABLE NOT DEFINED\n";
+    } else {
+        program.raise(fault);
     }
 }
 
 void InputStatement::execute(VarState& state, Program& program) const {
-    int value;
-    std::string input;
+    if (program.suspendInput()) {
+        program.requestInput(var_slot_); // 分段执行：暂停等待 provideInput
+        return;
+    }
+    state.setValue(var_slot_, readValue(program.output()));
+}
 
+int InputStatement::readValue(Output& out) {
+    std::string input;
     while (true) {
-        std::cout << " ? ";
+        out << " ? ";
+        // 阻塞读取前把已缓冲的输出（包括提示符）写出
+        out.flush();
         // 读取一整行输入（包含所有字符，包括空格和特殊符号）
         if (!std::getline(std::cin, input)) {
             // 处理输入流错误
             std::cin.clear();
-            std::cout << "INVALID NUMBER" << std::endl;
+            out << "INVALID NUMBER\n";
             continue;
         }
-        // 修剪输入前后的空格
-        size_t start = input.find_first_not_of(" \t");
-        if (start == std::string::npos) {
-            // 空输入（全是空格）
-            std::cout << "INVALID NUMBER" << std::endl;
-            continue;
+        if (auto value = parseValue(input)) {
+            return *value; // 输入合法，退出循环
         }
-        size_t end = input.find_last_not_of(" \t");
-        std::string trimmed = input.substr(start, end - start + 1);
-
-        // 验证是否为有效整数（排除小数）
-        if (isValidInteger(trimmed)) {
-            try {
-                // 检查整数范围是否在int可表示范围内
-                long long num = std::stoll(trimmed);
-                if (num < std::numeric_limits<int>::min() || num > std::numeric_limits<int>::max()) {
-                    throw std::out_of_range("");
-                }
-                value = static_cast<int>(num);
-                break; // 输入合法，退出循环
-            } catch (const std::out_of_range&) {
-                // 整数超出范围
-                std::cout << "INVALID NUMBER" << std::endl;
-            } catch (const std::invalid_argument&) {
-                std::cout << "INVALID NUMBER" << std::endl;
-            }
-        } else {
-            // 包含非数字字符（如小数点、字母等）
-            std::cout << "INVALID NUMBER" << std::endl;
+        out << "INVALID NUMBER\n";
+    }
+}
+
+std::optional<int> InputStatement::parseValue(std::string_view input) {
+    // 修剪输入前后的空格
+    size_t start = input.find_first_not_of(" \t");
+    if (start == std::string_view::npos) {
+        // 空输入（全是空格）
+        return std::nullopt;
+    }
+    size_t end = input.find_last_not_of(" \t");
+    std::string trimmed(input.substr(start, end - start + 1));
+
+    // 验证是否为有效整数（排除小数、字母等）
+    if (!isValidInteger(trimmed)) {
+        return std::nullopt;
+    }
+    try {
+        // 检查整数范围是否在int可表示范围内
+        long long num = std::stoll(trimmed);
+        if (num < std::numeric_limits<int>::min() || num > std::numeric_limits<int>::max()) {
+            return std::nullopt;
         }
+        return static_cast<int>(num);
+    } catch (const std::out_of_range&) {
+        // 整数超出范围
+        return std::nullopt;
+    } catch (const std::invalid_argument&) {
+        return std::nullopt;
     }
-    state.setValue(var_name_, value);
 }
 
 void GotoStatement::execute(VarState& state, Program& program) const {
-    if (!program.hasLine(target_line_)) {
-        throw BasicError("LINE NUMBER ERROR");
-    }
-    else {
-        program.changePC(target_line_);
+    program.gotoLine(target_line_);
+}
+
+IfStatement* IfStatement::create(std::string_view source, Expression* left, char op,
+                                 Expression* right, int target_line, bool fused) {
+    if (fused) {
+        const Expression* lhs = left;
+        const Expression* rhs = right;
+        char fusedOp = op;
+        if (lhs->kind() == ExprKind::CONST && rhs->kind() == ExprKind::VARIABLE) {
+            // c < v 即 v > c；两侧只有一个变量，求值顺序不影响报错
+            std::swap(lhs, rhs);
+            fusedOp = op == '<' ? '>' : op == '>' ? '<' : op;
+        }
+        IfStatement* stmt = nullptr;
+        if (lhs->kind() == ExprKind::VARIABLE && rhs->kind() == ExprKind::CONST) {
+            stmt = withOp<CompareConstStatement>(fusedOp, source, left, op, right,
+                                                 target_line, slotOf(lhs), valueOf(rhs));
+        } else if (lhs->kind() == ExprKind::VARIABLE && rhs->kind() == ExprKind::VARIABLE) {
+            stmt = withOp<CompareVarsStatement>(fusedOp, source, left, op, right,
+                                                target_line, slotOf(lhs), slotOf(rhs));
+        }
+        if (stmt) {
+            return stmt;
+        }
     }
+    return new IfStatement(source, left, op, right, target_line);
 }
 
 void IfStatement::execute(VarState& state, Program& program) const {
-    int lhs = left_->evaluate(state);
-    int rhs = right_->evaluate(state);
+    Fault fault;
+    arith::Word lhs = left_->evaluate(state, fault);
+    arith::Word rhs = right_->evaluate(state, fault);
+    if (fault) {
+        program.raise(fault);
+        return;
+    }
     bool condition = false;
     
     switch (op_) {
@@ -132,14 +253,36 @@ void IfStatement::execute(VarState& state, Program& program) const {
             condition = (lhs < rhs);
             break;
         default:
-            throw BasicError("SYNTAX ERROR");
+            fault.raise(ErrorCode::SYNTAX_ERROR);
+            program.raise(fault);
+            return;
     }
     
     if (condition) {
-        if (!program.hasLine(target_line_)) {
-            throw BasicError("LINE NUMBER ERROR");
-        }
-        program.changePC(target_line_);
+        program.jumpTo(target_line_);
+    }
+}
+
+template <char Op>
+void CompareConstStatement<Op>::execute(VarState& state, Program& program) const {
+    Fault fault;
+    int lhs = state.getValue(slot_, fault);
+    if (fault) {
+        program.raise(fault);
+    } else if (compare<Op>(lhs, value_)) {
+        program.jumpTo(targetLine());
+    }
+}
+
+template <char Op>
+void CompareVarsStatement<Op>::execute(VarState& state, Program& program) const {
+    Fault fault;
+    int lhs = state.getValue(left_slot_, fault);
+    int rhs = state.getValue(right_slot_, fault);
+    if (fault) {
+        program.raise(fault);
+    } else if (compare<Op>(lhs, rhs)) {
+        program.jumpTo(targetLine());
     }
 }
 
@@ -148,4 +291,16 @@ void RemStatement::execute(VarState& state, Program& program) const {
 
 void EndStatement::execute(VarState& state, Program& program) const {
     program.programEnd();
+}
+
+void IndentStatement::execute(VarState& state, Program& program) const {
+    state.enterScope();
+}
+
+void DedentStatement::execute(VarState& state, Program& program) const {
+    Fault fault;
+    state.exitScope(fault);
+    if (fault) {
+        program.raise(fault);
+    }
 }
\ No newline at end of file
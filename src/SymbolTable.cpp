@@ -0,0 +1,28 @@
+#include "SymbolTable.hpp"
+
+SymbolTable& SymbolTable::global() {
+  static SymbolTable table;
+  return table;
+}
+
+int SymbolTable::intern(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slots_.find(name);
+  if (it != slots_.end()) {
+    return it->second;
+  }
+  int slot = static_cast<int>(names_.size());
+  names_.emplace_back(name);
+  slots_.emplace(names_.back(), slot);
+  size_.store(slot + 1, std::memory_order_release);
+  return slot;
+}
+
+const std::string& SymbolTable::name(int slot) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return names_[slot];
+}
+
+int SymbolTable::size() const noexcept {
+  return size_.load(std::memory_order_acquire);
+}
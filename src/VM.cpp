@@ -0,0 +1,205 @@
+#include "VM.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "Arith.hpp"
+#include "Output.hpp"
+#include "Statement.hpp"
+#include "VarState.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BASIC_VM_COMPUTED_GOTO 1
+#endif
+
+VMExit VM::run(const Bytecode& bytecode, VarState& state, Output& out,
+               VMContext& context, uint64_t budget) const {
+  if (budget == kUnlimited) {
+    return execute<false>(bytecode, state, out, context, budget);
+  }
+  return execute<true>(bytecode, state, out, context, budget);
+}
+
+template <bool Budgeted>
+VMExit VM::execute(const Bytecode& bytecode, VarState& state, Output& out,
+                   VMContext& context, uint64_t budget) const {
+  std::vector<arith::Word> stack(bytecode.maxStack + 1);
+  arith::Word* const base = stack.data();
+  arith::Word* sp = base;
+
+  const int32_t* const code = bytecode.code.data();
+  const uint8_t* const starts = bytecode.starts.data();
+  const int32_t* ip = code + context.ip;
+  // 当前 PRINT 语句的结束位置；非 PRINT 语句时为空
+  const int32_t* guard = nullptr;
+  Fault& fault = context.fault;
+
+  // 每行的第一条指令计一条语句。预算用完时停在这一行开头，下次从这里继续
+#define VM_CHECK_BUDGET()         \
+  if constexpr (Budgeted) {       \
+    if (starts[ip - code] != 0) { \
+      if (budget == 0) {          \
+        context.ip = ip - code;   \
+        return VMExit::BUDGET;    \
+      }                           \
+      --budget;                   \
+    }                             \
+  }
+
+  // 回绕策略下加减乘不会出错，检查在编译期去除
+#define VM_CHECK_OVERFLOW()                            \
+  if constexpr (arith::kPolicy != arith::Policy::WRAP) { \
+    if (fault) {                                       \
+      goto error;                                      \
+    }                                                  \
+  }
+
+#ifdef BASIC_VM_COMPUTED_GOTO
+  // 顺序必须与 OpCode 保持一致
+  static void* const kLabels[] = {
+      &&L_CONST, &&L_LOAD,  &&L_ADD, &&L_SUB, &&L_MUL, &&L_DIV,
+      &&L_STORE, &&L_GUARD, &&L_PRINT, &&L_INPUT, &&L_JMP, &&L_JEQ,
+      &&L_JLT,   &&L_JGT,   &&L_INDENT, &&L_DEDENT, &&L_FAIL, &&L_HALT,
+      &&L_LINK};
+#define VM_CASE(name) L_##name:
+#define VM_DISPATCH()        \
+  do {                       \
+    VM_CHECK_BUDGET();       \
+    goto* kLabels[*ip++];    \
+  } while (0)
+  VM_DISPATCH();
+#else
+#define VM_CASE(name) case OpCode::name:
+#define VM_DISPATCH() continue
+  for (;;) {
+    VM_CHECK_BUDGET();
+    switch (static_cast<OpCode>(*ip++)) {
+#endif
+  VM_CASE(CONST) {
+    *sp++ = *ip++;
+    VM_DISPATCH();
+  }
+  VM_CASE(LOAD) {
+    int slot = *ip++;
+    if (!state.isDefined(slot)) {
+      if (guard == nullptr) {
+        fault.raise(ErrorCode::VARIABLE_NOT_DEFINED, slot);
+        goto error;
+      }
+      // 与 PrintStatement 一致：输出提示后继续执行下一条语句
+      out << "VARIABLE NOT DEFINED\n";
+      ip = guard;
+      guard = nullptr;
+      sp = base;
+      VM_DISPATCH();
+    }
+    *sp++ = state.peek(slot);
+    VM_DISPATCH();
+  }
+  VM_CASE(ADD) {
+    --sp;
+    sp[-1] = arith::add(sp[-1], sp[0], fault);
+    VM_CHECK_OVERFLOW();
+    VM_DISPATCH();
+  }
+  VM_CASE(SUB) {
+    --sp;
+    sp[-1] = arith::sub(sp[-1], sp[0], fault);
+    VM_CHECK_OVERFLOW();
+    VM_DISPATCH();
+  }
+  VM_CASE(MUL) {
+    --sp;
+    sp[-1] = arith::mul(sp[-1], sp[0], fault);
+    VM_CHECK_OVERFLOW();
+    VM_DISPATCH();
+  }
+  VM_CASE(DIV) {
+    --sp;
+    sp[-1] = arith::div(sp[-1], sp[0], fault);
+    if (fault) {
+      goto error;
+    }
+    VM_DISPATCH();
+  }
+  VM_CASE(STORE) {
+    int slot = *ip++;
+    int value = arith::narrow(*--sp, fault);
+    if constexpr (arith::kPolicy == arith::Policy::WIDEN) {
+      if (fault) {
+        goto error;
+      }
+    }
+    state.setValue(slot, value);
+    VM_DISPATCH();
+  }
+  VM_CASE(GUARD) {
+    guard = code + *ip++;
+    VM_DISPATCH();
+  }
+  VM_CASE(PRINT) {
+    out << *--sp << '\n';
+    guard = nullptr;
+    VM_DISPATCH();
+  }
+  VM_CASE(INPUT) {
+    int slot = *ip++;
+    if (context.suspendInput) {
+      // 由调用者提供输入后从下一条指令继续
+      context.ip = ip - code;
+      context.inputSlot = slot;
+      return VMExit::INPUT;
+    }
+    state.setValue(slot, InputStatement::readValue(out));
+    VM_DISPATCH();
+  }
+  VM_CASE(JMP) {
+    ip = code + *ip;
+    VM_DISPATCH();
+  }
+  VM_CASE(LINK) {
+    ip = code + *ip;
+    VM_DISPATCH();
+  }
+  VM_CASE(JEQ) {
+    sp -= 2;
+    ip = sp[0] == sp[1] ? code + *ip : ip + 1;
+    VM_DISPATCH();
+  }
+  VM_CASE(JLT) {
+    sp -= 2;
+    ip = sp[0] < sp[1] ? code + *ip : ip + 1;
+    VM_DISPATCH();
+  }
+  VM_CASE(JGT) {
+    sp -= 2;
+    ip = sp[0] > sp[1] ? code + *ip : ip + 1;
+    VM_DISPATCH();
+  }
+  VM_CASE(INDENT) {
+    state.enterScope();
+    VM_DISPATCH();
+  }
+  VM_CASE(DEDENT) {
+    state.exitScope(fault);
+    if (fault) {
+      goto error;
+    }
+    VM_DISPATCH();
+  }
+  VM_CASE(FAIL) {
+    fault.raise(ErrorCode::LINE_NUMBER_ERROR);
+    goto error;
+  }
+  VM_CASE(HALT) { return VMExit::HALT; }
+#ifndef BASIC_VM_COMPUTED_GOTO
+    }
+  }
+#endif
+error:
+  return VMExit::ERROR;
+#undef VM_CASE
+#undef VM_DISPATCH
+#undef VM_CHECK_BUDGET
+#undef VM_CHECK_OVERFLOW
+}
@@ -2,18 +2,64 @@
 
 #include <algorithm>
 
-#include "utils/Error.hpp"
 
-void VarState::setValue(const std::string& name, int value) {
-  values_[name] = value;
+void VarState::clear() {
+  std::fill(defined_.begin(), defined_.end(), 0);
+  std::fill(levels_.begin(), levels_.end(), 0);
+  undo_.clear();
+  frames_.clear();
 }
 
-int VarState::getValue(const std::string& name) const {
-  auto it = values_.find(name);
-  if (it == values_.end()) {
-    throw BasicError("VARIABLE NOT DEFINED");
+void VarState::enterScope() { frames_.push_back(undo_.size()); }
+
+void VarState::exitScope(Fault& fault) {
+  if (frames_.empty()) {
+    fault.raise(ErrorCode::SCOPE_UNDERFLOW);
+    return;
+  }
+  restore(frames_.back());
+  frames_.pop_back();
+}
+
+void VarState::resetScopes() noexcept {
+  if (!frames_.empty()) {
+    restore(frames_.front());
+    frames_.clear();
   }
-  return it->second;
 }
 
-void VarState::clear() { values_.clear(); }
+void VarState::define(int slot, int value) {
+  uint32_t level = static_cast<uint32_t>(frames_.size());
+  bool defined = isDefined(slot);
+  // 本层已定义过的变量直接赋值，否则先记下被遮蔽的绑定
+  if (!defined || levels_[slot] != level) {
+    undo_.push_back(Shadow{slot, values_[slot], levels_[slot], defined});
+    levels_[slot] = level;
+    defined_[slot >> 6] |= uint64_t{1} << (slot & 63);
+  }
+  values_[slot] = value;
+}
+
+void VarState::restore(size_t mark) noexcept {
+  // 逆序恢复，同一槽位被多次遮蔽时最终回到最早的绑定
+  while (undo_.size() > mark) {
+    const Shadow& shadow = undo_.back();
+    values_[shadow.slot] = shadow.value;
+    levels_[shadow.slot] = shadow.level;
+    uint64_t bit = uint64_t{1} << (shadow.slot & 63);
+    if (shadow.defined) {
+      defined_[shadow.slot >> 6] |= bit;
+    } else {
+      defined_[shadow.slot >> 6] &= ~bit;
+    }
+    undo_.pop_back();
+  }
+}
+
+void VarState::grow(int slot) {
+  // 按倍数扩容，避免逐个增长；大小只取决于本变量表用到的槽位
+  size_t size = std::max(static_cast<size_t>(slot) + 1, values_.size() * 2);
+  values_.resize(size, 0);
+  levels_.resize(size, 0);
+  defined_.resize((size + 63) / 64, 0);
+}
@@ -2,7 +2,31 @@
 
 #include <utility>
 
+const char* errorMessage(ErrorCode code) noexcept {
+  switch (code) {
+    case ErrorCode::NONE:
+      return "";
+    case ErrorCode::VARIABLE_NOT_DEFINED:
+      return "VARIABLE NOT DEFINED";
+    case ErrorCode::DIVIDE_BY_ZERO:
+      return "DIVIDE BY ZERO";
+    case ErrorCode::INTEGER_OVERFLOW:
+      return "INTEGER OVERFLOW";
+    case ErrorCode::LINE_NUMBER_ERROR:
+      return "LINE NUMBER ERROR";
+    case ErrorCode::SCOPE_UNDERFLOW:
+      return "SCOPE UNDERFLOW";
+    case ErrorCode::UNSUPPORTED_OPERATOR:
+      return "UNSUPPORTED OPERATOR";
+    case ErrorCode::SYNTAX_ERROR:
+      return "SYNTAX ERROR";
+  }
+  return "";
+}
+
 BasicError::BasicError(std::string&& message)
     : std::runtime_error(message), message_(std::move(message)) {}
 
+BasicError::BasicError(const Fault& fault) : BasicError(fault.message()) {}
+
 const std::string& BasicError::message() const noexcept { return message_; }
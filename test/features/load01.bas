@@ -0,0 +1,1217 @@
+10 LET S = 0
+20 INPUT N
+5000 PRINT 111
+5010 PRINT 333
+1000 LET S = S + 1
+1001 LET S = S + 1
+1002 LET S = S + 1
+1003 LET S = S + 1
+1004 LET S = S + 1
+1005 LET S = S + 1
+1006 LET S = S + 1
+1007 LET S = S + 1
+1008 LET S = S + 1
+1009 LET S = S + 1
+1010 LET S = S + 1
+1011 LET S = S + 1
+1012 LET S = S + 1
+1013 LET S = S + 1
+1014 LET S = S + 1
+1015 LET S = S + 1
+1016 LET S = S + 1
+1017 LET S = S + 1
+1018 LET S = S + 1
+1019 LET S = S + 1
+1020 LET S = S + 1
+1021 LET S = S + 1
+1022 LET S = S + 1
+1023 LET S = S + 1
+1024 LET S = S + 1
+1025 LET S = S + 1
+1026 LET S = S + 1
+1027 LET S = S + 1
+1028 LET S = S + 1
+1029 LET S = S + 1
+1030 LET S = S + 1
+1031 LET S = S + 1
+1032 LET S = S + 1
+1033 LET S = S + 1
+1034 LET S = S + 1
+1035 LET S = S + 1
+1036 LET S = S + 1
+1037 LET S = S + 1
+1038 LET S = S + 1
+1039 LET S = S + 1
+1040 LET S = S + 1
+1041 LET S = S + 1
+1042 LET S = S + 1
+1043 LET S = S + 1
+1044 LET S = S + 1
+1045 LET S = S + 1
+1046 LET S = S + 1
+1047 LET S = S + 1
+1048 LET S = S + 1
+1049 LET S = S + 1
+1050 LET S = S + 1
+1051 LET S = S + 1
+1052 LET S = S + 1
+1053 LET S = S + 1
+1054 LET S = S + 1
+1055 LET S = S + 1
+1056 LET S = S + 1
+1057 LET S = S + 1
+1058 LET S = S + 1
+1059 LET S = S + 1
+1060 LET S = S + 1
+1061 LET S = S + 1
+1062 LET S = S + 1
+1063 LET S = S + 1
+1064 LET S = S + 1
+1065 LET S = S + 1
+1066 LET S = S + 1
+1067 LET S = S + 1
+1068 LET S = S + 1
+1069 LET S = S + 1
+1070 LET S = S + 1
+1071 LET S = S + 1
+1072 LET S = S + 1
+1073 LET S = S + 1
+1074 LET S = S + 1
+1075 LET S = S + 1
+1076 LET S = S + 1
+1077 LET S = S + 1
+1078 LET S = S + 1
+1079 LET S = S + 1
+1080 LET S = S + 1
+1081 LET S = S + 1
+1082 LET S = S + 1
+1083 LET S = S + 1
+1084 LET S = S + 1
+1085 LET S = S + 1
+1086 LET S = S + 1
+1087 LET S = S + 1
+1088 LET S = S + 1
+1089 LET S = S + 1
+1090 LET S = S + 1
+1091 LET S = S + 1
+1092 LET S = S + 1
+1093 LET S = S + 1
+1094 LET S = S + 1
+1095 LET S = S + 1
+1096 LET S = S + 1
+1097 LET S = S + 1
+1098 LET S = S + 1
+1099 LET S = S + 1
+1100 LET S = S + 1
+1101 LET S = S + 1
+1102 LET S = S + 1
+1103 LET S = S + 1
+1104 LET S = S + 1
+1105 LET S = S + 1
+1106 LET S = S + 1
+1107 LET S = S + 1
+1108 LET S = S + 1
+1109 LET S = S + 1
+1110 LET S = S + 1
+1111 LET S = S + 1
+1112 LET S = S + 1
+1113 LET S = S + 1
+1114 LET S = S + 1
+1115 LET S = S + 1
+1116 LET S = S + 1
+1117 LET S = S + 1
+1118 LET S = S + 1
+1119 LET S = S + 1
+1120 LET S = S + 1
+1121 LET S = S + 1
+1122 LET S = S + 1
+1123 LET S = S + 1
+1124 LET S = S + 1
+1125 LET S = S + 1
+1126 LET S = S + 1
+1127 LET S = S + 1
+1128 LET S = S + 1
+1129 LET S = S + 1
+1130 LET S = S + 1
+1131 LET S = S + 1
+1132 LET S = S + 1
+1133 LET S = S + 1
+1134 LET S = S + 1
+1135 LET S = S + 1
+1136 LET S = S + 1
+1137 LET S = S + 1
+1138 LET S = S + 1
+1139 LET S = S + 1
+1140 LET S = S + 1
+1141 LET S = S + 1
+1142 LET S = S + 1
+1143 LET S = S + 1
+1144 LET S = S + 1
+1145 LET S = S + 1
+1146 LET S = S + 1
+1147 LET S = S + 1
+1148 LET S = S + 1
+1149 LET S = S + 1
+1150 LET S = S + 1
+1151 LET S = S + 1
+1152 LET S = S + 1
+1153 LET S = S + 1
+1154 LET S = S + 1
+1155 LET S = S + 1
+1156 LET S = S + 1
+1157 LET S = S + 1
+1158 LET S = S + 1
+1159 LET S = S + 1
+1160 LET S = S + 1
+1161 LET S = S + 1
+1162 LET S = S + 1
+1163 LET S = S + 1
+1164 LET S = S + 1
+1165 LET S = S + 1
+1166 LET S = S + 1
+1167 LET S = S + 1
+1168 LET S = S + 1
+1169 LET S = S + 1
+1170 LET S = S + 1
+1171 LET S = S + 1
+1172 LET S = S + 1
+1173 LET S = S + 1
+1174 LET S = S + 1
+1175 LET S = S + 1
+1176 LET S = S + 1
+1177 LET S = S + 1
+1178 LET S = S + 1
+1179 LET S = S + 1
+1180 LET S = S + 1
+1181 LET S = S + 1
+1182 LET S = S + 1
+1183 LET S = S + 1
+1184 LET S = S + 1
+1185 LET S = S + 1
+1186 LET S = S + 1
+1187 LET S = S + 1
+1188 LET S = S + 1
+1189 LET S = S + 1
+1190 LET S = S + 1
+1191 LET S = S + 1
+1192 LET S = S + 1
+1193 LET S = S + 1
+1194 LET S = S + 1
+1195 LET S = S + 1
+1196 LET S = S + 1
+1197 LET S = S + 1
+1198 LET S = S + 1
+1199 LET S = S + 1
+1200 LET S = S + 1
+1201 LET S = S + 1
+1202 LET S = S + 1
+1203 LET S = S + 1
+1204 LET S = S + 1
+1205 LET S = S + 1
+1206 LET S = S + 1
+1207 LET S = S + 1
+1208 LET S = S + 1
+1209 LET S = S + 1
+1210 LET S = S + 1
+1211 LET S = S + 1
+1212 LET S = S + 1
+1213 LET S = S + 1
+1214 LET S = S + 1
+1215 LET S = S + 1
+1216 LET S = S + 1
+1217 LET S = S + 1
+1218 LET S = S + 1
+1219 LET S = S + 1
+1220 LET S = S + 1
+1221 LET S = S + 1
+1222 LET S = S + 1
+1223 LET S = S + 1
+1224 LET S = S + 1
+1225 LET S = S + 1
+1226 LET S = S + 1
+1227 LET S = S + 1
+1228 LET S = S + 1
+1229 LET S = S + 1
+1230 LET S = S + 1
+1231 LET S = S + 1
+1232 LET S = S + 1
+1233 LET S = S + 1
+1234 LET S = S + 1
+1235 LET S = S + 1
+1236 LET S = S + 1
+1237 LET S = S + 1
+1238 LET S = S + 1
+1239 LET S = S + 1
+1240 LET S = S + 1
+1241 LET S = S + 1
+1242 LET S = S + 1
+1243 LET S = S + 1
+1244 LET S = S + 1
+1245 LET S = S + 1
+1246 LET S = S + 1
+1247 LET S = S + 1
+1248 LET S = S + 1
+1249 LET S = S + 1
+1250 LET S = S + 1
+1251 LET S = S + 1
+1252 LET S = S + 1
+1253 LET S = S + 1
+1254 LET S = S + 1
+1255 LET S = S + 1
+1256 LET S = S + 1
+1257 LET S = S + 1
+1258 LET S = S + 1
+1259 LET S = S + 1
+1260 LET S = S + 1
+1261 LET S = S + 1
+1262 LET S = S + 1
+1263 LET S = S + 1
+1264 LET S = S + 1
+1265 LET S = S + 1
+1266 LET S = S + 1
+1267 LET S = S + 1
+1268 LET S = S + 1
+1269 LET S = S + 1
+1270 LET S = S + 1
+1271 LET S = S + 1
+1272 LET S = S + 1
+1273 LET S = S + 1
+1274 LET S = S + 1
+1275 LET S = S + 1
+1276 LET S = S + 1
+1277 LET S = S + 1
+1278 LET S = S + 1
+1279 LET S = S + 1
+1280 LET S = S + 1
+1281 LET S = S + 1
+1282 LET S = S + 1
+1283 LET S = S + 1
+1284 LET S = S + 1
+1285 LET S = S + 1
+1286 LET S = S + 1
+1287 LET S = S + 1
+1288 LET S = S + 1
+1289 LET S = S + 1
+1290 LET S = S + 1
+1291 LET S = S + 1
+1292 LET S = S + 1
+1293 LET S = S + 1
+1294 LET S = S + 1
+1295 LET S = S + 1
+1296 LET S = S + 1
+1297 LET S = S + 1
+1298 LET S = S + 1
+1299 LET S = S + 1
+1300 LET S = S + 1
+1301 LET S = S + 1
+1302 LET S = S + 1
+1303 LET S = S + 1
+1304 LET S = S + 1
+1305 LET S = S + 1
+1306 LET S = S + 1
+1307 LET S = S + 1
+1308 LET S = S + 1
+1309 LET S = S + 1
+1310 LET S = S + 1
+1311 LET S = S + 1
+1312 LET S = S + 1
+1313 LET S = S + 1
+1314 LET S = S + 1
+1315 LET S = S + 1
+1316 LET S = S + 1
+1317 LET S = S + 1
+1318 LET S = S + 1
+1319 LET S = S + 1
+1320 LET S = S + 1
+1321 LET S = S + 1
+1322 LET S = S + 1
+1323 LET S = S + 1
+1324 LET S = S + 1
+1325 LET S = S + 1
+1326 LET S = S + 1
+1327 LET S = S + 1
+1328 LET S = S + 1
+1329 LET S = S + 1
+1330 LET S = S + 1
+1331 LET S = S + 1
+1332 LET S = S + 1
+1333 LET S = S + 1
+1334 LET S = S + 1
+1335 LET S = S + 1
+1336 LET S = S + 1
+1337 LET S = S + 1
+1338 LET S = S + 1
+1339 LET S = S + 1
+1340 LET S = S + 1
+1341 LET S = S + 1
+1342 LET S = S + 1
+1343 LET S = S + 1
+1344 LET S = S + 1
+1345 LET S = S + 1
+1346 LET S = S + 1
+1347 LET S = S + 1
+1348 LET S = S + 1
+1349 LET S = S + 1
+1350 LET S = S + 1
+1351 LET S = S + 1
+1352 LET S = S + 1
+1353 LET S = S + 1
+1354 LET S = S + 1
+1355 LET S = S + 1
+1356 LET S = S + 1
+1357 LET S = S + 1
+1358 LET S = S + 1
+1359 LET S = S + 1
+1360 LET S = S + 1
+1361 LET S = S + 1
+1362 LET S = S + 1
+1363 LET S = S + 1
+1364 LET S = S + 1
+1365 LET S = S + 1
+1366 LET S = S + 1
+1367 LET S = S + 1
+1368 LET S = S + 1
+1369 LET S = S + 1
+1370 LET S = S + 1
+1371 LET S = S + 1
+1372 LET S = S + 1
+1373 LET S = S + 1
+1374 LET S = S + 1
+1375 LET S = S + 1
+1376 LET S = S + 1
+1377 LET S = S + 1
+1378 LET S = S + 1
+1379 LET S = S + 1
+1380 LET S = S + 1
+1381 LET S = S + 1
+1382 LET S = S + 1
+1383 LET S = S + 1
+1384 LET S = S + 1
+1385 LET S = S + 1
+1386 LET S = S + 1
+1387 LET S = S + 1
+1388 LET S = S + 1
+1389 LET S = S + 1
+1390 LET S = S + 1
+1391 LET S = S + 1
+1392 LET S = S + 1
+1393 LET S = S + 1
+1394 LET S = S + 1
+1395 LET S = S + 1
+1396 LET S = S + 1
+1397 LET S = S + 1
+1398 LET S = S + 1
+1399 LET S = S + 1
+1400 LET S = S + 1
+1401 LET S = S + 1
+1402 LET S = S + 1
+1403 LET S = S + 1
+1404 LET S = S + 1
+1405 LET S = S + 1
+1406 LET S = S + 1
+1407 LET S = S + 1
+1408 LET S = S + 1
+1409 LET S = S + 1
+1410 LET S = S + 1
+1411 LET S = S + 1
+1412 LET S = S + 1
+1413 LET S = S + 1
+1414 LET S = S + 1
+1415 LET S = S + 1
+1416 LET S = S + 1
+1417 LET S = S + 1
+1418 LET S = S + 1
+1419 LET S = S + 1
+1420 LET S = S + 1
+1421 LET S = S + 1
+1422 LET S = S + 1
+1423 LET S = S + 1
+1424 LET S = S + 1
+1425 LET S = S + 1
+1426 LET S = S + 1
+1427 LET S = S + 1
+1428 LET S = S + 1
+1429 LET S = S + 1
+1430 LET S = S + 1
+1431 LET S = S + 1
+1432 LET S = S + 1
+1433 LET S = S + 1
+1434 LET S = S + 1
+1435 LET S = S + 1
+1436 LET S = S + 1
+1437 LET S = S + 1
+1438 LET S = S + 1
+1439 LET S = S + 1
+1440 LET S = S + 1
+1441 LET S = S + 1
+1442 LET S = S + 1
+1443 LET S = S + 1
+1444 LET S = S + 1
+1445 LET S = S + 1
+1446 LET S = S + 1
+1447 LET S = S + 1
+1448 LET S = S + 1
+1449 LET S = S + 1
+1450 LET S = S + 1
+1451 LET S = S + 1
+1452 LET S = S + 1
+1453 LET S = S + 1
+1454 LET S = S + 1
+1455 LET S = S + 1
+1456 LET S = S + 1
+1457 LET S = S + 1
+1458 LET S = S + 1
+1459 LET S = S + 1
+1460 LET S = S + 1
+1461 LET S = S + 1
+1462 LET S = S + 1
+1463 LET S = S + 1
+1464 LET S = S + 1
+1465 LET S = S + 1
+1466 LET S = S + 1
+1467 LET S = S + 1
+1468 LET S = S + 1
+1469 LET S = S + 1
+1470 LET S = S + 1
+1471 LET S = S + 1
+1472 LET S = S + 1
+1473 LET S = S + 1
+1474 LET S = S + 1
+1475 LET S = S + 1
+1476 LET S = S + 1
+1477 LET S = S + 1
+1478 LET S = S + 1
+1479 LET S = S + 1
+1480 LET S = S + 1
+1481 LET S = S + 1
+1482 LET S = S + 1
+1483 LET S = S + 1
+1484 LET S = S + 1
+1485 LET S = S + 1
+1486 LET S = S + 1
+1487 LET S = S + 1
+1488 LET S = S + 1
+1489 LET S = S + 1
+1490 LET S = S + 1
+1491 LET S = S + 1
+1492 LET S = S + 1
+1493 LET S = S + 1
+1494 LET S = S + 1
+1495 LET S = S + 1
+1496 LET S = S + 1
+1497 LET S = S + 1
+1498 LET S = S + 1
+1499 LET S = S + 1
+1500 LET S = S + 1
+1501 LET S = S + 1
+1502 LET S = S + 1
+1503 LET S = S + 1
+1504 LET S = S + 1
+1505 LET S = S + 1
+1506 LET S = S + 1
+1507 LET S = S + 1
+1508 LET S = S + 1
+1509 LET S = S + 1
+1510 LET S = S + 1
+1511 LET S = S + 1
+1512 LET S = S + 1
+1513 LET S = S + 1
+1514 LET S = S + 1
+1515 LET S = S + 1
+1516 LET S = S + 1
+1517 LET S = S + 1
+1518 LET S = S + 1
+1519 LET S = S + 1
+1520 LET S = S + 1
+1521 LET S = S + 1
+1522 LET S = S + 1
+1523 LET S = S + 1
+1524 LET S = S + 1
+1525 LET S = S + 1
+1526 LET S = S + 1
+1527 LET S = S + 1
+1528 LET S = S + 1
+1529 LET S = S + 1
+1530 LET S = S + 1
+1531 LET S = S + 1
+1532 LET S = S + 1
+1533 LET S = S + 1
+1534 LET S = S + 1
+1535 LET S = S + 1
+1536 LET S = S + 1
+1537 LET S = S + 1
+1538 LET S = S + 1
+1539 LET S = S + 1
+1540 LET S = S + 1
+1541 LET S = S + 1
+1542 LET S = S + 1
+1543 LET S = S + 1
+1544 LET S = S + 1
+1545 LET S = S + 1
+1546 LET S = S + 1
+1547 LET S = S + 1
+1548 LET S = S + 1
+1549 LET S = S + 1
+1550 LET S = S + 1
+1551 LET S = S + 1
+1552 LET S = S + 1
+1553 LET S = S + 1
+1554 LET S = S + 1
+1555 LET S = S + 1
+1556 LET S = S + 1
+1557 LET S = S + 1
+1558 LET S = S + 1
+1559 LET S = S + 1
+1560 LET S = S + 1
+1561 LET S = S + 1
+1562 LET S = S + 1
+1563 LET S = S + 1
+1564 LET S = S + 1
+1565 LET S = S + 1
+1566 LET S = S + 1
+1567 LET S = S + 1
+1568 LET S = S + 1
+1569 LET S = S + 1
+1570 LET S = S + 1
+1571 LET S = S + 1
+1572 LET S = S + 1
+1573 LET S = S + 1
+1574 LET S = S + 1
+1575 LET S = S + 1
+1576 LET S = S + 1
+1577 LET S = S + 1
+1578 LET S = S + 1
+1579 LET S = S + 1
+1580 LET S = S + 1
+1581 LET S = S + 1
+1582 LET S = S + 1
+1583 LET S = S + 1
+1584 LET S = S + 1
+1585 LET S = S + 1
+1586 LET S = S + 1
+1587 LET S = S + 1
+1588 LET S = S + 1
+1589 LET S = S + 1
+1590 LET S = S + 1
+1591 LET S = S + 1
+1592 LET S = S + 1
+1593 LET S = S + 1
+1594 LET S = S + 1
+1595 LET S = S + 1
+1596 LET S = S + 1
+1597 LET S = S + 1
+1598 LET S = S + 1
+1599 LET S = S + 1
+6000 LET X = (1
+6010 PRINT 7)
+1600 LET S = S + 1
+1601 LET S = S + 1
+1602 LET S = S + 1
+1603 LET S = S + 1
+1604 LET S = S + 1
+1605 LET S = S + 1
+1606 LET S = S + 1
+1607 LET S = S + 1
+1608 LET S = S + 1
+1609 LET S = S + 1
+1610 LET S = S + 1
+1611 LET S = S + 1
+1612 LET S = S + 1
+1613 LET S = S + 1
+1614 LET S = S + 1
+1615 LET S = S + 1
+1616 LET S = S + 1
+1617 LET S = S + 1
+1618 LET S = S + 1
+1619 LET S = S + 1
+1620 LET S = S + 1
+1621 LET S = S + 1
+1622 LET S = S + 1
+1623 LET S = S + 1
+1624 LET S = S + 1
+1625 LET S = S + 1
+1626 LET S = S + 1
+1627 LET S = S + 1
+1628 LET S = S + 1
+1629 LET S = S + 1
+1630 LET S = S + 1
+1631 LET S = S + 1
+1632 LET S = S + 1
+1633 LET S = S + 1
+1634 LET S = S + 1
+1635 LET S = S + 1
+1636 LET S = S + 1
+1637 LET S = S + 1
+1638 LET S = S + 1
+1639 LET S = S + 1
+1640 LET S = S + 1
+1641 LET S = S + 1
+1642 LET S = S + 1
+1643 LET S = S + 1
+1644 LET S = S + 1
+1645 LET S = S + 1
+1646 LET S = S + 1
+1647 LET S = S + 1
+1648 LET S = S + 1
+1649 LET S = S + 1
+1650 LET S = S + 1
+1651 LET S = S + 1
+1652 LET S = S + 1
+1653 LET S = S + 1
+1654 LET S = S + 1
+1655 LET S = S + 1
+1656 LET S = S + 1
+1657 LET S = S + 1
+1658 LET S = S + 1
+1659 LET S = S + 1
+1660 LET S = S + 1
+1661 LET S = S + 1
+1662 LET S = S + 1
+1663 LET S = S + 1
+1664 LET S = S + 1
+1665 LET S = S + 1
+1666 LET S = S + 1
+1667 LET S = S + 1
+1668 LET S = S + 1
+1669 LET S = S + 1
+1670 LET S = S + 1
+1671 LET S = S + 1
+1672 LET S = S + 1
+1673 LET S = S + 1
+1674 LET S = S + 1
+1675 LET S = S + 1
+1676 LET S = S + 1
+1677 LET S = S + 1
+1678 LET S = S + 1
+1679 LET S = S + 1
+1680 LET S = S + 1
+1681 LET S = S + 1
+1682 LET S = S + 1
+1683 LET S = S + 1
+1684 LET S = S + 1
+1685 LET S = S + 1
+1686 LET S = S + 1
+1687 LET S = S + 1
+1688 LET S = S + 1
+1689 LET S = S + 1
+1690 LET S = S + 1
+1691 LET S = S + 1
+1692 LET S = S + 1
+1693 LET S = S + 1
+1694 LET S = S + 1
+1695 LET S = S + 1
+1696 LET S = S + 1
+1697 LET S = S + 1
+1698 LET S = S + 1
+1699 LET S = S + 1
+1700 LET S = S + 1
+1701 LET S = S + 1
+1702 LET S = S + 1
+1703 LET S = S + 1
+1704 LET S = S + 1
+1705 LET S = S + 1
+1706 LET S = S + 1
+1707 LET S = S + 1
+1708 LET S = S + 1
+1709 LET S = S + 1
+1710 LET S = S + 1
+1711 LET S = S + 1
+1712 LET S = S + 1
+1713 LET S = S + 1
+1714 LET S = S + 1
+1715 LET S = S + 1
+1716 LET S = S + 1
+1717 LET S = S + 1
+1718 LET S = S + 1
+1719 LET S = S + 1
+1720 LET S = S + 1
+1721 LET S = S + 1
+1722 LET S = S + 1
+1723 LET S = S + 1
+1724 LET S = S + 1
+1725 LET S = S + 1
+1726 LET S = S + 1
+1727 LET S = S + 1
+1728 LET S = S + 1
+1729 LET S = S + 1
+1730 LET S = S + 1
+1731 LET S = S + 1
+1732 LET S = S + 1
+1733 LET S = S + 1
+1734 LET S = S + 1
+1735 LET S = S + 1
+1736 LET S = S + 1
+1737 LET S = S + 1
+1738 LET S = S + 1
+1739 LET S = S + 1
+1740 LET S = S + 1
+1741 LET S = S + 1
+1742 LET S = S + 1
+1743 LET S = S + 1
+1744 LET S = S + 1
+1745 LET S = S + 1
+1746 LET S = S + 1
+1747 LET S = S + 1
+1748 LET S = S + 1
+1749 LET S = S + 1
+1750 LET S = S + 1
+1751 LET S = S + 1
+1752 LET S = S + 1
+1753 LET S = S + 1
+1754 LET S = S + 1
+1755 LET S = S + 1
+1756 LET S = S + 1
+1757 LET S = S + 1
+1758 LET S = S + 1
+1759 LET S = S + 1
+1760 LET S = S + 1
+1761 LET S = S + 1
+1762 LET S = S + 1
+1763 LET S = S + 1
+1764 LET S = S + 1
+1765 LET S = S + 1
+1766 LET S = S + 1
+1767 LET S = S + 1
+1768 LET S = S + 1
+1769 LET S = S + 1
+1770 LET S = S + 1
+1771 LET S = S + 1
+1772 LET S = S + 1
+1773 LET S = S + 1
+1774 LET S = S + 1
+1775 LET S = S + 1
+1776 LET S = S + 1
+1777 LET S = S + 1
+1778 LET S = S + 1
+1779 LET S = S + 1
+1780 LET S = S + 1
+1781 LET S = S + 1
+1782 LET S = S + 1
+1783 LET S = S + 1
+1784 LET S = S + 1
+1785 LET S = S + 1
+1786 LET S = S + 1
+1787 LET S = S + 1
+1788 LET S = S + 1
+1789 LET S = S + 1
+1790 LET S = S + 1
+1791 LET S = S + 1
+1792 LET S = S + 1
+1793 LET S = S + 1
+1794 LET S = S + 1
+1795 LET S = S + 1
+1796 LET S = S + 1
+1797 LET S = S + 1
+1798 LET S = S + 1
+1799 LET S = S + 1
+1800 LET S = S + 1
+1801 LET S = S + 1
+1802 LET S = S + 1
+1803 LET S = S + 1
+1804 LET S = S + 1
+1805 LET S = S + 1
+1806 LET S = S + 1
+1807 LET S = S + 1
+1808 LET S = S + 1
+1809 LET S = S + 1
+1810 LET S = S + 1
+1811 LET S = S + 1
+1812 LET S = S + 1
+1813 LET S = S + 1
+1814 LET S = S + 1
+1815 LET S = S + 1
+1816 LET S = S + 1
+1817 LET S = S + 1
+1818 LET S = S + 1
+1819 LET S = S + 1
+1820 LET S = S + 1
+1821 LET S = S + 1
+1822 LET S = S + 1
+1823 LET S = S + 1
+1824 LET S = S + 1
+1825 LET S = S + 1
+1826 LET S = S + 1
+1827 LET S = S + 1
+1828 LET S = S + 1
+1829 LET S = S + 1
+1830 LET S = S + 1
+1831 LET S = S + 1
+1832 LET S = S + 1
+1833 LET S = S + 1
+1834 LET S = S + 1
+1835 LET S = S + 1
+1836 LET S = S + 1
+1837 LET S = S + 1
+1838 LET S = S + 1
+1839 LET S = S + 1
+1840 LET S = S + 1
+1841 LET S = S + 1
+1842 LET S = S + 1
+1843 LET S = S + 1
+1844 LET S = S + 1
+1845 LET S = S + 1
+1846 LET S = S + 1
+1847 LET S = S + 1
+1848 LET S = S + 1
+1849 LET S = S + 1
+1850 LET S = S + 1
+1851 LET S = S + 1
+1852 LET S = S + 1
+1853 LET S = S + 1
+1854 LET S = S + 1
+1855 LET S = S + 1
+1856 LET S = S + 1
+1857 LET S = S + 1
+1858 LET S = S + 1
+1859 LET S = S + 1
+1860 LET S = S + 1
+1861 LET S = S + 1
+1862 LET S = S + 1
+1863 LET S = S + 1
+1864 LET S = S + 1
+1865 LET S = S + 1
+1866 LET S = S + 1
+1867 LET S = S + 1
+1868 LET S = S + 1
+1869 LET S = S + 1
+1870 LET S = S + 1
+1871 LET S = S + 1
+1872 LET S = S + 1
+1873 LET S = S + 1
+1874 LET S = S + 1
+1875 LET S = S + 1
+1876 LET S = S + 1
+1877 LET S = S + 1
+1878 LET S = S + 1
+1879 LET S = S + 1
+1880 LET S = S + 1
+1881 LET S = S + 1
+1882 LET S = S + 1
+1883 LET S = S + 1
+1884 LET S = S + 1
+1885 LET S = S + 1
+1886 LET S = S + 1
+1887 LET S = S + 1
+1888 LET S = S + 1
+1889 LET S = S + 1
+1890 LET S = S + 1
+1891 LET S = S + 1
+1892 LET S = S + 1
+1893 LET S = S + 1
+1894 LET S = S + 1
+1895 LET S = S + 1
+1896 LET S = S + 1
+1897 LET S = S + 1
+1898 LET S = S + 1
+1899 LET S = S + 1
+1900 LET S = S + 1
+1901 LET S = S + 1
+1902 LET S = S + 1
+1903 LET S = S + 1
+1904 LET S = S + 1
+1905 LET S = S + 1
+1906 LET S = S + 1
+1907 LET S = S + 1
+1908 LET S = S + 1
+1909 LET S = S + 1
+1910 LET S = S + 1
+1911 LET S = S + 1
+1912 LET S = S + 1
+1913 LET S = S + 1
+1914 LET S = S + 1
+1915 LET S = S + 1
+1916 LET S = S + 1
+1917 LET S = S + 1
+1918 LET S = S + 1
+1919 LET S = S + 1
+1920 LET S = S + 1
+1921 LET S = S + 1
+1922 LET S = S + 1
+1923 LET S = S + 1
+1924 LET S = S + 1
+1925 LET S = S + 1
+1926 LET S = S + 1
+1927 LET S = S + 1
+1928 LET S = S + 1
+1929 LET S = S + 1
+1930 LET S = S + 1
+1931 LET S = S + 1
+1932 LET S = S + 1
+1933 LET S = S + 1
+1934 LET S = S + 1
+1935 LET S = S + 1
+1936 LET S = S + 1
+1937 LET S = S + 1
+1938 LET S = S + 1
+1939 LET S = S + 1
+1940 LET S = S + 1
+1941 LET S = S + 1
+1942 LET S = S + 1
+1943 LET S = S + 1
+1944 LET S = S + 1
+1945 LET S = S + 1
+1946 LET S = S + 1
+1947 LET S = S + 1
+1948 LET S = S + 1
+1949 LET S = S + 1
+1950 LET S = S + 1
+1951 LET S = S + 1
+1952 LET S = S + 1
+1953 LET S = S + 1
+1954 LET S = S + 1
+1955 LET S = S + 1
+1956 LET S = S + 1
+1957 LET S = S + 1
+1958 LET S = S + 1
+1959 LET S = S + 1
+1960 LET S = S + 1
+1961 LET S = S + 1
+1962 LET S = S + 1
+1963 LET S = S + 1
+1964 LET S = S + 1
+1965 LET S = S + 1
+1966 LET S = S + 1
+1967 LET S = S + 1
+1968 LET S = S + 1
+1969 LET S = S + 1
+1970 LET S = S + 1
+1971 LET S = S + 1
+1972 LET S = S + 1
+1973 LET S = S + 1
+1974 LET S = S + 1
+1975 LET S = S + 1
+1976 LET S = S + 1
+1977 LET S = S + 1
+1978 LET S = S + 1
+1979 LET S = S + 1
+1980 LET S = S + 1
+1981 LET S = S + 1
+1982 LET S = S + 1
+1983 LET S = S + 1
+1984 LET S = S + 1
+1985 LET S = S + 1
+1986 LET S = S + 1
+1987 LET S = S + 1
+1988 LET S = S + 1
+1989 LET S = S + 1
+1990 LET S = S + 1
+1991 LET S = S + 1
+1992 LET S = S + 1
+1993 LET S = S + 1
+1994 LET S = S + 1
+1995 LET S = S + 1
+1996 LET S = S + 1
+1997 LET S = S + 1
+1998 LET S = S + 1
+1999 LET S = S + 1
+2000 LET S = S + 1
+2001 LET S = S + 1
+2002 LET S = S + 1
+2003 LET S = S + 1
+2004 LET S = S + 1
+2005 LET S = S + 1
+2006 LET S = S + 1
+2007 LET S = S + 1
+2008 LET S = S + 1
+2009 LET S = S + 1
+2010 LET S = S + 1
+2011 LET S = S + 1
+2012 LET S = S + 1
+2013 LET S = S + 1
+2014 LET S = S + 1
+2015 LET S = S + 1
+2016 LET S = S + 1
+2017 LET S = S + 1
+2018 LET S = S + 1
+2019 LET S = S + 1
+2020 LET S = S + 1
+2021 LET S = S + 1
+2022 LET S = S + 1
+2023 LET S = S + 1
+2024 LET S = S + 1
+2025 LET S = S + 1
+2026 LET S = S + 1
+2027 LET S = S + 1
+2028 LET S = S + 1
+2029 LET S = S + 1
+2030 LET S = S + 1
+2031 LET S = S + 1
+2032 LET S = S + 1
+2033 LET S = S + 1
+2034 LET S = S + 1
+2035 LET S = S + 1
+2036 LET S = S + 1
+2037 LET S = S + 1
+2038 LET S = S + 1
+2039 LET S = S + 1
+2040 LET S = S + 1
+2041 LET S = S + 1
+2042 LET S = S + 1
+2043 LET S = S + 1
+2044 LET S = S + 1
+2045 LET S = S + 1
+2046 LET S = S + 1
+2047 LET S = S + 1
+2048 LET S = S + 1
+2049 LET S = S + 1
+2050 LET S = S + 1
+2051 LET S = S + 1
+2052 LET S = S + 1
+2053 LET S = S + 1
+2054 LET S = S + 1
+2055 LET S = S + 1
+2056 LET S = S + 1
+2057 LET S = S + 1
+2058 LET S = S + 1
+2059 LET S = S + 1
+2060 LET S = S + 1
+2061 LET S = S + 1
+2062 LET S = S + 1
+2063 LET S = S + 1
+2064 LET S = S + 1
+2065 LET S = S + 1
+2066 LET S = S + 1
+2067 LET S = S + 1
+2068 LET S = S + 1
+2069 LET S = S + 1
+2070 LET S = S + 1
+2071 LET S = S + 1
+2072 LET S = S + 1
+2073 LET S = S + 1
+2074 LET S = S + 1
+2075 LET S = S + 1
+2076 LET S = S + 1
+2077 LET S = S + 1
+2078 LET S = S + 1
+2079 LET S = S + 1
+2080 LET S = S + 1
+2081 LET S = S + 1
+2082 LET S = S + 1
+2083 LET S = S + 1
+2084 LET S = S + 1
+2085 LET S = S + 1
+2086 LET S = S + 1
+2087 LET S = S + 1
+2088 LET S = S + 1
+2089 LET S = S + 1
+2090 LET S = S + 1
+2091 LET S = S + 1
+2092 LET S = S + 1
+2093 LET S = S + 1
+2094 LET S = S + 1
+2095 LET S = S + 1
+2096 LET S = S + 1
+2097 LET S = S + 1
+5000 PRINT 222
+5010
+2098 LET S = S + 1
+2099 LET S = S + 1
+2100 LET S = S + 1
+2101 LET S = S + 1
+2102 LET S = S + 1
+2103 LET S = S + 1
+2104 LET S = S + 1
+2105 LET S = S + 1
+2106 LET S = S + 1
+2107 LET S = S + 1
+2108 LET S = S + 1
+2109 LET S = S + 1
+2110 LET S = S + 1
+2111 LET S = S + 1
+2112 LET S = S + 1
+2113 LET S = S + 1
+2114 LET S = S + 1
+2115 LET S = S + 1
+2116 LET S = S + 1
+2117 LET S = S + 1
+2118 LET S = S + 1
+2119 LET S = S + 1
+2120 LET S = S + 1
+2121 LET S = S + 1
+2122 LET S = S + 1
+2123 LET S = S + 1
+2124 LET S = S + 1
+2125 LET S = S + 1
+2126 LET S = S + 1
+2127 LET S = S + 1
+2128 LET S = S + 1
+2129 LET S = S + 1
+2130 LET S = S + 1
+2131 LET S = S + 1
+2132 LET S = S + 1
+2133 LET S = S + 1
+2134 LET S = S + 1
+2135 LET S = S + 1
+2136 LET S = S + 1
+2137 LET S = S + 1
+2138 LET S = S + 1
+2139 LET S = S + 1
+2140 LET S = S + 1
+2141 LET S = S + 1
+2142 LET S = S + 1
+2143 LET S = S + 1
+2144 LET S = S + 1
+2145 LET S = S + 1
+2146 LET S = S + 1
+2147 LET S = S + 1
+2148 LET S = S + 1
+2149 LET S = S + 1
+2150 LET S = S + 1
+2151 LET S = S + 1
+2152 LET S = S + 1
+2153 LET S = S + 1
+2154 LET S = S + 1
+2155 LET S = S + 1
+2156 LET S = S + 1
+2157 LET S = S + 1
+2158 LET S = S + 1
+2159 LET S = S + 1
+2160 LET S = S + 1
+2161 LET S = S + 1
+2162 LET S = S + 1
+2163 LET S = S + 1
+2164 LET S = S + 1
+2165 LET S = S + 1
+2166 LET S = S + 1
+2167 LET S = S + 1
+2168 LET S = S + 1
+2169 LET S = S + 1
+2170 LET S = S + 1
+2171 LET S = S + 1
+2172 LET S = S + 1
+2173 LET S = S + 1
+2174 LET S = S + 1
+2175 LET S = S + 1
+2176 LET S = S + 1
+2177 LET S = S + 1
+2178 LET S = S + 1
+2179 LET S = S + 1
+2180 LET S = S + 1
+2181 LET S = S + 1
+2182 LET S = S + 1
+2183 LET S = S + 1
+2184 LET S = S + 1
+2185 LET S = S + 1
+2186 LET S = S + 1
+2187 LET S = S + 1
+2188 LET S = S + 1
+2189 LET S = S + 1
+2190 LET S = S + 1
+2191 LET S = S + 1
+2192 LET S = S + 1
+2193 LET S = S + 1
+2194 LET S = S + 1
+2195 LET S = S + 1
+2196 LET S = S + 1
+2197 LET S = S + 1
+2198 LET S = S + 1
+2199 LET S = S + 1
+8000 PRINT S
+8010 PRINT N
+RUN
+abc
+5
+LOAD ../test/features/load01_inner.bas
+42
+LOAD ../test/features/load01_deep.bas
+8020 PRINT 999
@@ -0,0 +1,2 @@
+LOAD ../test/features/load01_deep.bas
+PRINT 1
@@ -0,0 +1,2 @@
+8010 PRINT N * 2
+RUN